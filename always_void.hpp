@@ -0,0 +1,14 @@
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+namespace hpx { namespace util {
+
+    template <typename... Ts>
+    struct always_void
+    {
+        using type = void;
+    };
+}}    // namespace hpx::util
@@ -0,0 +1,468 @@
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// atomic_tuple<Ts...> provides atomic load/store/exchange/compare_exchange for
+// trivially copyable tuples. Tuples of 1, 2, 4 or 8 bytes map onto a single
+// machine word, tuples of 16 bytes use a double-width CAS where the target
+// supports it (e.g. x86-64 compiled with -mcx16, or AArch64). Everything else
+// falls back to a seqlock, which is not lock-free but keeps readers from ever
+// blocking writers.
+//
+// atomic_tuple is not available if HPX_TUPLE_HAVE_INSTRUMENTATION is defined,
+// the instrumented tuples are not trivially copyable.
+
+#pragma once
+
+#include "try_tuple.hpp"
+
+#include <atomic>
+#include <cstddef>    // for size_t
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+namespace hpx {
+
+    namespace detail {
+
+        // clang and gcc >= 11 can zero the padding bits of an object, which
+        // makes compare_exchange independent of the (indeterminate) padding of
+        // the tuples involved
+        template <typename T>
+        inline void atomic_tuple_clear_padding(T& value) noexcept
+        {
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_clear_padding)
+            __builtin_clear_padding(&value);
+#endif
+#endif
+            (void) value;
+        }
+
+        constexpr inline int atomic_tuple_order(std::memory_order order) noexcept
+        {
+            return static_cast<int>(order);
+        }
+
+        constexpr inline int atomic_tuple_failure_order(
+            std::memory_order order) noexcept
+        {
+            return order == std::memory_order_acq_rel ?
+                static_cast<int>(std::memory_order_acquire) :
+                order == std::memory_order_release ?
+                static_cast<int>(std::memory_order_relaxed) :
+                static_cast<int>(order);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <std::size_t Size>
+        struct atomic_tuple_word
+        {
+        };
+
+        template <>
+        struct atomic_tuple_word<1>
+        {
+            using type = std::uint8_t;
+        };
+
+        template <>
+        struct atomic_tuple_word<2>
+        {
+            using type = std::uint16_t;
+        };
+
+        template <>
+        struct atomic_tuple_word<4>
+        {
+            using type = std::uint32_t;
+        };
+
+        template <>
+        struct atomic_tuple_word<8>
+        {
+            using type = std::uint64_t;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Tuples fitting into a single machine word
+        template <typename T, typename Enable = void>
+        class atomic_tuple_storage
+        {
+            using word_type = typename atomic_tuple_word<sizeof(T)>::type;
+
+            static word_type to_word(T value) noexcept
+            {
+                atomic_tuple_clear_padding(value);
+                word_type word;
+                std::memcpy(&word, &value, sizeof(T));
+                return word;
+            }
+
+            static T from_word(word_type word) noexcept
+            {
+                T value;
+                std::memcpy(static_cast<void*>(std::addressof(value)), &word,
+                    sizeof(T));
+                return value;
+            }
+
+        public:
+            static constexpr bool is_always_lock_free =
+                __atomic_always_lock_free(sizeof(word_type), 0);
+
+            atomic_tuple_storage() noexcept
+              : word_(to_word(T()))
+            {
+            }
+
+            explicit atomic_tuple_storage(T const& value) noexcept
+              : word_(to_word(value))
+            {
+            }
+
+            T load(std::memory_order order) const noexcept
+            {
+                return from_word(
+                    __atomic_load_n(&word_, atomic_tuple_order(order)));
+            }
+
+            void store(T const& value, std::memory_order order) noexcept
+            {
+                __atomic_store_n(
+                    &word_, to_word(value), atomic_tuple_order(order));
+            }
+
+            T exchange(T const& value, std::memory_order order) noexcept
+            {
+                return from_word(__atomic_exchange_n(
+                    &word_, to_word(value), atomic_tuple_order(order)));
+            }
+
+            bool compare_exchange(T& expected, T const& desired, bool weak,
+                std::memory_order order) noexcept
+            {
+                word_type expected_word = to_word(expected);
+                if (__atomic_compare_exchange_n(&word_, &expected_word,
+                        to_word(desired), weak, atomic_tuple_order(order),
+                        atomic_tuple_failure_order(order)))
+                {
+                    return true;
+                }
+                expected = from_word(expected_word);
+                return false;
+            }
+
+        private:
+            alignas(sizeof(word_type)) word_type word_;
+        };
+
+#if defined(__SIZEOF_INT128__) && defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16)
+        ///////////////////////////////////////////////////////////////////////
+        // Tuples of 16 bytes, relying on a double-width CAS instruction
+        // (cmpxchg16b, casp). Loads are implemented as a CAS which does not
+        // change the stored value, the __sync builtins are full barriers, so
+        // the requested memory order is always satisfied.
+        template <typename T>
+        class atomic_tuple_storage<T,
+            typename std::enable_if<sizeof(T) == 16>::type>
+        {
+            using word_type = unsigned __int128;
+
+            static word_type to_word(T value) noexcept
+            {
+                atomic_tuple_clear_padding(value);
+                word_type word;
+                std::memcpy(&word, &value, sizeof(T));
+                return word;
+            }
+
+            static T from_word(word_type word) noexcept
+            {
+                T value;
+                std::memcpy(static_cast<void*>(std::addressof(value)), &word,
+                    sizeof(T));
+                return value;
+            }
+
+            word_type cas(word_type expected, word_type desired) const noexcept
+            {
+                return __sync_val_compare_and_swap(&word_, expected, desired);
+            }
+
+        public:
+            static constexpr bool is_always_lock_free = true;
+
+            atomic_tuple_storage() noexcept
+              : word_(to_word(T()))
+            {
+            }
+
+            explicit atomic_tuple_storage(T const& value) noexcept
+              : word_(to_word(value))
+            {
+            }
+
+            T load(std::memory_order) const noexcept
+            {
+                return from_word(cas(0, 0));
+            }
+
+            void store(T const& value, std::memory_order order) noexcept
+            {
+                exchange(value, order);
+            }
+
+            T exchange(T const& value, std::memory_order) noexcept
+            {
+                word_type const desired = to_word(value);
+                word_type expected = cas(0, 0);
+                for (word_type current; (current = cas(expected, desired)) !=
+                     expected;
+                     expected = current)
+                {
+                }
+                return from_word(expected);
+            }
+
+            bool compare_exchange(T& expected, T const& desired, bool /*weak*/,
+                std::memory_order) noexcept
+            {
+                word_type const expected_word = to_word(expected);
+                word_type const current = cas(expected_word, to_word(desired));
+                if (current == expected_word)
+                    return true;
+
+                expected = from_word(current);
+                return false;
+            }
+
+        private:
+            alignas(16) mutable word_type word_;
+        };
+#endif
+
+        ///////////////////////////////////////////////////////////////////////
+        // Seqlock fallback for all other sizes. The sequence number is odd
+        // while a writer is active; readers retry until they observe the same
+        // even sequence number before and after copying the value. The value
+        // is copied word by word using relaxed atomic accesses, which keeps
+        // the concurrent reads well-defined.
+        template <typename T>
+        class atomic_tuple_storage<T,
+            typename std::enable_if<sizeof(T) != 1 && sizeof(T) != 2 &&
+                sizeof(T) != 4 && sizeof(T) != 8
+#if defined(__SIZEOF_INT128__) && defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16)
+                && sizeof(T) != 16
+#endif
+                >::type>
+        {
+            using word_type = std::uintptr_t;
+
+            static constexpr std::size_t num_words =
+                (sizeof(T) + sizeof(word_type) - 1) / sizeof(word_type);
+
+            struct buffer
+            {
+                word_type words[num_words];
+            };
+
+            static buffer to_buffer(T value) noexcept
+            {
+                atomic_tuple_clear_padding(value);
+                buffer buf = {};
+                std::memcpy(buf.words, &value, sizeof(T));
+                return buf;
+            }
+
+            static T from_buffer(buffer const& buf) noexcept
+            {
+                T value;
+                std::memcpy(static_cast<void*>(std::addressof(value)),
+                    buf.words, sizeof(T));
+                return value;
+            }
+
+            buffer read() const noexcept
+            {
+                buffer buf;
+                for (std::size_t i = 0; i != num_words; ++i)
+                {
+                    buf.words[i] =
+                        __atomic_load_n(&data_.words[i], __ATOMIC_RELAXED);
+                }
+                return buf;
+            }
+
+            void write(buffer const& buf) noexcept
+            {
+                for (std::size_t i = 0; i != num_words; ++i)
+                {
+                    __atomic_store_n(
+                        &data_.words[i], buf.words[i], __ATOMIC_RELAXED);
+                }
+            }
+
+            std::size_t lock() noexcept
+            {
+                std::size_t seq = seq_.load(std::memory_order_relaxed);
+                while ((seq & 1) != 0 ||
+                    !seq_.compare_exchange_weak(
+                        seq, seq + 1, std::memory_order_acquire))
+                {
+                    seq = seq_.load(std::memory_order_relaxed);
+                }
+                std::atomic_thread_fence(std::memory_order_release);
+                return seq + 1;
+            }
+
+            void unlock(std::size_t seq) noexcept
+            {
+                seq_.store(seq + 1, std::memory_order_release);
+            }
+
+        public:
+            static constexpr bool is_always_lock_free = false;
+
+            atomic_tuple_storage() noexcept
+              : data_(to_buffer(T()))
+            {
+            }
+
+            explicit atomic_tuple_storage(T const& value) noexcept
+              : data_(to_buffer(value))
+            {
+            }
+
+            T load(std::memory_order) const noexcept
+            {
+                for (;;)
+                {
+                    std::size_t const seq = seq_.load(std::memory_order_acquire);
+                    if ((seq & 1) != 0)
+                        continue;
+
+                    buffer const buf = read();
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    if (seq_.load(std::memory_order_relaxed) == seq)
+                        return from_buffer(buf);
+                }
+            }
+
+            void store(T const& value, std::memory_order) noexcept
+            {
+                buffer const buf = to_buffer(value);
+                std::size_t const seq = lock();
+                write(buf);
+                unlock(seq);
+            }
+
+            T exchange(T const& value, std::memory_order) noexcept
+            {
+                buffer const buf = to_buffer(value);
+                std::size_t const seq = lock();
+                buffer const old = read();
+                write(buf);
+                unlock(seq);
+                return from_buffer(old);
+            }
+
+            bool compare_exchange(T& expected, T const& desired, bool /*weak*/,
+                std::memory_order) noexcept
+            {
+                buffer const expected_buf = to_buffer(expected);
+                buffer const desired_buf = to_buffer(desired);
+
+                std::size_t const seq = lock();
+                buffer const current = read();
+                bool const equal = std::memcmp(current.words,
+                                       expected_buf.words, sizeof(T)) == 0;
+                if (equal)
+                    write(desired_buf);
+                unlock(seq);
+
+                if (!equal)
+                    expected = from_buffer(current);
+                return equal;
+            }
+
+        private:
+            std::atomic<std::size_t> seq_{0};
+            buffer data_;
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Values are compared bitwise by compare_exchange (as for std::atomic),
+    // not by using operator==.
+    template <typename... Ts>
+    class atomic_tuple
+    {
+    public:
+        using value_type = tuple<Ts...>;
+
+        static_assert(std::is_trivially_copyable<value_type>::value,
+            "atomic_tuple requires a trivially copyable tuple (tuples are not "
+            "trivially copyable if HPX_TUPLE_HAVE_INSTRUMENTATION is defined)");
+
+        static constexpr bool is_always_lock_free =
+            detail::atomic_tuple_storage<value_type>::is_always_lock_free;
+
+        atomic_tuple() noexcept = default;
+
+        explicit atomic_tuple(value_type const& value) noexcept
+          : storage_(value)
+        {
+        }
+
+        atomic_tuple(atomic_tuple const&) = delete;
+        atomic_tuple& operator=(atomic_tuple const&) = delete;
+
+        bool is_lock_free() const noexcept
+        {
+            return is_always_lock_free;
+        }
+
+        value_type load(
+            std::memory_order order = std::memory_order_seq_cst) const noexcept
+        {
+            return storage_.load(order);
+        }
+
+        void store(value_type const& value,
+            std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+            storage_.store(value, order);
+        }
+
+        value_type exchange(value_type const& value,
+            std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+            return storage_.exchange(value, order);
+        }
+
+        bool compare_exchange_weak(value_type& expected,
+            value_type const& desired,
+            std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+            return storage_.compare_exchange(expected, desired, true, order);
+        }
+
+        bool compare_exchange_strong(value_type& expected,
+            value_type const& desired,
+            std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+            return storage_.compare_exchange(expected, desired, false, order);
+        }
+
+        operator value_type() const noexcept
+        {
+            return load();
+        }
+
+    private:
+        detail::atomic_tuple_storage<value_type> storage_;
+    };
+}    // namespace hpx
@@ -0,0 +1,112 @@
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Helpers shared by the benchmarks. Every benchmark prints one line per
+// measurement, "<name> <value> <unit>", where smaller values are better.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>    // for size_t
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace hpx { namespace benchmark {
+
+    // Keeps the compiler from optimizing away the computation of value.
+    template <typename T>
+    inline void do_not_optimize(T const& value)
+    {
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+
+    // Runs f(k) for k in [0, num_threads) on num_threads threads which are
+    // released at the same time. Returns the seconds elapsed between their
+    // release and the end of the last one.
+    template <typename F>
+    double run_threads(std::size_t num_threads, F const& f)
+    {
+        std::atomic<std::size_t> ready(0);
+        std::atomic<bool> go(false);
+
+        std::vector<std::thread> threads;
+        threads.reserve(num_threads);
+        for (std::size_t k = 0; k != num_threads; ++k)
+        {
+            threads.emplace_back([&, k] {
+                ++ready;
+                while (!go.load(std::memory_order_acquire))
+                    std::this_thread::yield();
+                f(k);
+            });
+        }
+        while (ready.load() != num_threads)
+            std::this_thread::yield();
+
+        auto const start = std::chrono::steady_clock::now();
+        go.store(true, std::memory_order_release);
+        for (auto& t : threads)
+            t.join();
+
+        return std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start)
+            .count();
+    }
+
+    // 1, 2, 4, ... up to the number of hardware threads and at most
+    // max_threads. More threads than the hardware runs at the same time would
+    // only be time sliced, and would make the results depend on the scheduler.
+    inline std::vector<std::size_t> thread_counts(
+        std::size_t max_threads = std::size_t(-1))
+    {
+        std::size_t const hardware_threads =
+            (std::max)(std::thread::hardware_concurrency(), 1u);
+        std::size_t const limit = (std::min)(max_threads, hardware_threads);
+
+        std::vector<std::size_t> result;
+        for (std::size_t n = 1; n <= limit; n *= 2)
+            result.push_back(n);
+        return result;
+    }
+
+    // The number of operations to run, from the first command line argument
+    // if given. Exits with an error if it is not a positive number.
+    inline std::size_t operations(
+        int argc, char* argv[], std::size_t default_value)
+    {
+        if (argc < 2)
+            return default_value;
+
+        // strtoull accepts leading white space and a sign, reject those
+        char const* arg = argv[1];
+        char* end = nullptr;
+        errno = 0;
+        unsigned long long const value =
+            std::isdigit(static_cast<unsigned char>(arg[0])) ?
+            std::strtoull(arg, &end, 10) :
+            0;
+        if (value == 0 || *end != '\0' || errno == ERANGE)
+        {
+            std::fprintf(stderr,
+                "%s: the number of operations has to be a positive number, "
+                "got '%s'\n",
+                argv[0], arg);
+            std::exit(EXIT_FAILURE);
+        }
+        return static_cast<std::size_t>(value);
+    }
+
+    inline void report(std::string const& name, double value, char const* unit)
+    {
+        std::printf("%s %.6g %s\n", name.c_str(), value, unit);
+        std::fflush(stdout);
+    }
+}}    // namespace hpx::benchmark
@@ -0,0 +1,219 @@
+#!/usr/bin/env python3
+#  SPDX-License-Identifier: BSL-1.0
+#  Distributed under the Boost Software License, Version 1.0. (See accompanying
+#  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+# Runs the benchmarks a number of times and compares the median of every
+# measurement with the one recorded in a baseline file, failing if any got
+# slower by more than its threshold.
+#
+# The runtime benchmarks are executables printing "<name> <value> <unit>"
+# lines (see benchmark.hpp), for the compile-time benchmark the time it takes
+# to run the compiler command given after "--" is measured. Smaller values
+# are better for all of them.
+#
+# The noise of a measurement is estimated from the repeated runs as its
+# median absolute deviation relative to the median, scaled to be comparable
+# to a standard deviation. A measurement regressed if its median exceeds the
+# baseline by more than max(--threshold, --noise-factor * noise), where the
+# noise is the larger of the ones of the baseline and of the current runs.
+#
+# The baseline also records the machine it was measured on: the processor,
+# the number of hardware threads and the compiler. Measurements from another
+# machine are not comparable, the script refuses to compare them and asks for
+# a new baseline instead.
+#
+# --update records the current results as the new baseline instead.
+
+import argparse
+import json
+import os
+import platform
+import statistics
+import subprocess
+import sys
+import time
+
+# the version of the format of the baseline file
+BASELINE_VERSION = 2
+
+
+def parse_arguments():
+    parser = argparse.ArgumentParser(
+        description="Compares the benchmarks with a baseline.")
+    parser.add_argument("--baseline", required=True,
+                        help="the JSON file holding the baseline")
+    parser.add_argument("--update", action="store_true",
+                        help="write the current results to the baseline")
+    parser.add_argument("--repetitions", type=int, default=5,
+                        help="how often every benchmark is run")
+    parser.add_argument("--threshold", type=float, default=0.1,
+                        help="the smallest relative slowdown reported as a "
+                        "regression")
+    parser.add_argument("--noise-factor", type=float, default=3.0,
+                        help="the multiple of the noise a measurement has to "
+                        "exceed the baseline by to be reported")
+    parser.add_argument("--run", action="append", default=[],
+                        metavar="EXECUTABLE",
+                        help="a runtime benchmark, may be repeated")
+    parser.add_argument("--compile", metavar="NAME",
+                        help="the name of the compile-time benchmark, whose "
+                        "compiler command follows --")
+    parser.add_argument("--compiler", default="unknown",
+                        help="the compiler the benchmarks were built with, "
+                        "recorded with the machine")
+
+    argv = sys.argv[1:]
+    compile_command = []
+    if "--" in argv:
+        split = argv.index("--")
+        argv, compile_command = argv[:split], argv[split + 1:]
+
+    args = parser.parse_args(argv)
+    if bool(args.compile) != bool(compile_command):
+        parser.error("--compile requires a compiler command after --")
+    if args.repetitions < 1:
+        parser.error("--repetitions has to be positive")
+    args.compile_command = compile_command
+    return args
+
+
+def processor_name():
+    try:
+        with open("/proc/cpuinfo") as f:
+            for line in f:
+                if line.startswith("model name"):
+                    return line.split(":", 1)[1].strip()
+    except OSError:
+        pass
+    return platform.processor() or platform.machine()
+
+
+def current_machine(args):
+    return {
+        "processor": processor_name(),
+        "hardware_threads": os.cpu_count(),
+        "compiler": args.compiler,
+    }
+
+
+def run_benchmark(executable, samples):
+    output = subprocess.run([executable], stdout=subprocess.PIPE,
+                            universal_newlines=True, check=True).stdout
+    for line in output.splitlines():
+        fields = line.split()
+        if len(fields) != 3:
+            continue
+        name, value, unit = fields
+        samples.setdefault((name, unit), []).append(float(value))
+
+
+def run_compile_benchmark(name, command, samples):
+    start = time.perf_counter()
+    subprocess.run(command, check=True)
+    elapsed = time.perf_counter() - start
+    samples.setdefault(("compile/" + name, "s"), []).append(elapsed)
+
+
+def summarize(samples):
+    metrics = {}
+    for (name, unit), values in sorted(samples.items()):
+        median = statistics.median(values)
+        deviation = statistics.median(abs(v - median) for v in values)
+        noise = 1.4826 * deviation / median if median > 0 else 0.0
+        metrics[name] = {"unit": unit, "value": float("%.6g" % median),
+                         "noise": round(noise, 4)}
+    return metrics
+
+
+def read_baseline(path):
+    with open(path) as f:
+        baseline = json.load(f)
+    if baseline.get("version") != BASELINE_VERSION:
+        raise ValueError("{}: unsupported baseline version {}, expected {}"
+                         .format(path, baseline.get("version"),
+                                 BASELINE_VERSION))
+    return baseline
+
+
+def write_baseline(path, args, metrics):
+    baseline = {
+        "version": BASELINE_VERSION,
+        "machine": current_machine(args),
+        "repetitions": args.repetitions,
+        "metrics": metrics,
+    }
+    with open(path, "w") as f:
+        json.dump(baseline, f, indent=2, sort_keys=True)
+        f.write("\n")
+
+
+# Returns the number of regressions.
+def compare(args, baseline, metrics):
+    regressions = 0
+    for name, current in sorted(metrics.items()):
+        reference = baseline.get(name)
+        if reference is None:
+            print("{:<50} {:>12.6g} {:<6} new".format(
+                name, current["value"], current["unit"]))
+            continue
+
+        noise = max(reference["noise"], current["noise"])
+        threshold = max(args.threshold, args.noise_factor * noise)
+        change = current["value"] / reference["value"] - 1.0
+        regressed = change > threshold
+        regressions += regressed
+
+        print("{:<50} {:>12.6g} {:<6} {:+7.1%} (threshold {:.1%}){}".format(
+            name, current["value"], current["unit"], change, threshold,
+            " REGRESSION" if regressed else ""))
+
+    for name in sorted(set(baseline) - set(metrics)):
+        print("{:<50} missing from the current results".format(name))
+        regressions += 1
+
+    return regressions
+
+
+def main():
+    args = parse_arguments()
+
+    baseline = None
+    if not args.update:
+        if not os.path.exists(args.baseline):
+            print("{}: no baseline, record one with --update".format(
+                args.baseline), file=sys.stderr)
+            return 2
+        baseline = read_baseline(args.baseline)
+        machine = current_machine(args)
+        if baseline["machine"] != machine:
+            print("{}: recorded on another machine, record a new baseline "
+                  "with --update\n  baseline: {}\n  current:  {}".format(
+                      args.baseline, baseline["machine"], machine),
+                  file=sys.stderr)
+            return 2
+
+    samples = {}
+    for _ in range(args.repetitions):
+        for executable in args.run:
+            run_benchmark(executable, samples)
+        if args.compile:
+            run_compile_benchmark(args.compile, args.compile_command, samples)
+    metrics = summarize(samples)
+
+    if args.update:
+        write_baseline(args.baseline, args, metrics)
+        print("{}: recorded {} measurements".format(
+            args.baseline, len(metrics)))
+        return 0
+
+    regressions = compare(args, baseline["metrics"], metrics)
+    if regressions != 0:
+        print("{} measurement(s) regressed".format(regressions),
+              file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,92 @@
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Throughput of concurrent_tuple_map keyed by (id, name) tuples with 1 up to
+// the number of hardware threads. Lookups and updates probe with forward_as_tuple(id, name_view),
+// so no owning key is constructed. The read-heavy workload does 95% lookups
+// and 5% updates, the mixed workload 50% each.
+
+#include "benchmark.hpp"
+#include "concurrent_tuple_map.hpp"
+
+#include <cstddef>    // for size_t
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+    using key_type = hpx::tuple<std::uint32_t, std::string>;
+    using map_type = hpx::concurrent_tuple_map<key_type, std::uint64_t>;
+
+    std::uint64_t xorshift(std::uint64_t& state) noexcept
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+
+    void run(char const* workload, unsigned read_percent,
+        std::size_t num_operations)
+    {
+        std::size_t const num_keys = std::size_t(1) << 16;
+
+        // long enough to defeat the small string optimization
+        std::vector<std::string> names(num_keys);
+        for (std::size_t i = 0; i != num_keys; ++i)
+            names[i] = "customer-" + std::to_string(1000000 + i) + "-europe";
+
+        for (std::size_t num_threads : hpx::benchmark::thread_counts())
+        {
+            map_type map;
+            for (std::size_t i = 0; i != num_keys; ++i)
+                map.insert(key_type(std::uint32_t(i), names[i]), i);
+
+            std::size_t const per_thread = num_operations / num_threads;
+            double const seconds =
+                hpx::benchmark::run_threads(num_threads, [&](std::size_t k) {
+                    std::uint64_t state = 0x9e3779b97f4a7c15ull + k;
+                    std::uint64_t sum = 0;
+                    for (std::size_t n = 0; n != per_thread; ++n)
+                    {
+                        std::uint64_t const r = xorshift(state);
+                        std::size_t const i = r % num_keys;
+                        // forward_as_tuple only refers to its arguments,
+                        // they have to outlive the key
+                        std::uint32_t const id = std::uint32_t(i);
+                        std::string_view const name = names[i];
+                        auto const key = hpx::forward_as_tuple(id, name);
+
+                        if ((r >> 32) % 100 < read_percent)
+                        {
+                            std::uint64_t value = 0;
+                            map.find(key, value);
+                            sum += value;
+                        }
+                        else
+                        {
+                            map.visit(key, [](std::uint64_t& v) { ++v; });
+                        }
+                    }
+                    hpx::benchmark::do_not_optimize(sum);
+                });
+
+            hpx::benchmark::report(std::string("concurrent_tuple_map/") +
+                    workload + "/threads:" + std::to_string(num_threads),
+                seconds * 1e9 / double(per_thread * num_threads), "ns/op");
+        }
+    }
+}    // namespace
+
+int main(int argc, char* argv[])
+{
+    std::size_t const num_operations =
+        hpx::benchmark::operations(argc, argv, 2000000);
+
+    run("read_heavy", 95, num_operations);
+    run("mixed", 50, num_operations);
+    return 0;
+}
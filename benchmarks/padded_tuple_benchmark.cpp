@@ -0,0 +1,80 @@
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// False sharing between per-thread counters with 1 up to the number of
+// hardware threads (at most 64). Thread k increments element k of a tuple of
+// 64 counters, which share cache lines in a tuple and are each on their own
+// line in a padded_tuple. With a single hardware thread there is nothing to
+// share and both measure the same.
+
+#include "benchmark.hpp"
+#include "padded_tuple.hpp"
+
+#include <atomic>
+#include <cstddef>    // for size_t
+#include <cstdint>
+#include <string>
+#include <utility>
+
+namespace {
+
+    constexpr std::size_t num_counters = 64;
+
+    using counter = std::atomic<std::uint64_t>;
+
+    template <std::size_t, typename T>
+    using repeat = T;
+
+    template <template <typename...> class Tuple, std::size_t... Is>
+    Tuple<repeat<Is, counter>...> make_counters(std::index_sequence<Is...>);
+
+    template <template <typename...> class Tuple>
+    using counters = decltype(make_counters<Tuple>(
+        std::make_index_sequence<num_counters>{}));
+
+    // the elements are selected at run time, by the index of the thread
+    template <typename Tuple, std::size_t... Is>
+    void element_addresses(
+        Tuple& t, counter** addresses, std::index_sequence<Is...>)
+    {
+        ((addresses[Is] = &hpx::get<Is>(t)), ...);
+    }
+
+    template <template <typename...> class Tuple>
+    void run(char const* name, std::size_t num_operations)
+    {
+        for (std::size_t num_threads : hpx::benchmark::thread_counts(num_counters))
+        {
+            counters<Tuple> t;
+            counter* addresses[num_counters];
+            element_addresses(
+                t, addresses, std::make_index_sequence<num_counters>{});
+
+            std::size_t const per_thread = num_operations / num_threads;
+            double const seconds =
+                hpx::benchmark::run_threads(num_threads, [&](std::size_t k) {
+                    counter& c = *addresses[k];
+                    for (std::size_t n = 0; n != per_thread; ++n)
+                    {
+                        c.store(c.load(std::memory_order_relaxed) + 1,
+                            std::memory_order_relaxed);
+                    }
+                });
+
+            hpx::benchmark::report(std::string("false_sharing/") + name +
+                    "/threads:" + std::to_string(num_threads),
+                seconds * 1e9 / double(per_thread * num_threads), "ns/op");
+        }
+    }
+}    // namespace
+
+int main(int argc, char* argv[])
+{
+    std::size_t const num_operations =
+        hpx::benchmark::operations(argc, argv, 100000000);
+
+    run<hpx::tuple>("tuple", num_operations);
+    run<hpx::padded_tuple>("padded_tuple", num_operations);
+    return 0;
+}
@@ -0,0 +1,43 @@
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compile-time benchmark of tuple_cat: 16 calls, each concatenating 16 tuples
+// of 16 distinct element types. The interesting number is the time it takes
+// to compile this file, running it does nothing.
+
+#include "try_tuple.hpp"
+
+#include <utility>
+
+template <int Tuple, int Element>
+struct element
+{
+};
+
+template <int Tuple, int... Elements>
+hpx::tuple<element<Tuple, Elements>...> make_tuple_of(
+    std::integer_sequence<int, Elements...>);
+
+template <int Tuple>
+using tuple_of =
+    decltype(make_tuple_of<Tuple>(std::make_integer_sequence<int, 16>{}));
+
+template <int Call, int... Tuples>
+auto cat(std::integer_sequence<int, Tuples...>)
+{
+    return hpx::tuple_cat(tuple_of<Call * 16 + Tuples>{}...);
+}
+
+template <int... Calls>
+void cat_all(std::integer_sequence<int, Calls...>)
+{
+    (static_cast<void>(cat<Calls>(std::make_integer_sequence<int, 16>{})),
+        ...);
+}
+
+int main()
+{
+    cat_all(std::make_integer_sequence<int, 16>{});
+    return 0;
+}
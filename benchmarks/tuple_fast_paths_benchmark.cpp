@@ -0,0 +1,145 @@
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Single-threaded throughput of the paths of tuple which rely on its flat
+// storage and of the element-wise comparisons. Tuples of trivially copyable
+// elements are trivially copyable themselves, so copying a sequence of them
+// is a memmove and swapping two of them three memcpy's, and tuple_cat over
+// std::array's of such elements copies every input with a single memcpy. The
+// comparisons of tuples of scalars are measured over contiguous sequences of
+// tuples, where they are inlined into the loop and can be vectorized.
+
+#include "benchmark.hpp"
+#include "try_tuple.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>    // for size_t
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+    using flat_tuple = hpx::tuple<std::int32_t, float, double, std::int64_t>;
+    static_assert(std::is_trivially_copyable<flat_tuple>::value,
+        "the benchmark measures the paths for trivially copyable tuples");
+
+    using key_tuple =
+        hpx::tuple<std::int32_t, std::int32_t, std::int32_t, std::int32_t>;
+
+    constexpr std::size_t num_elements = std::size_t(1) << 14;
+
+    std::uint64_t xorshift(std::uint64_t& state) noexcept
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+
+    // Runs f once per pass over num_elements elements and reports the time
+    // per element.
+    template <typename F>
+    void measure(char const* name, std::size_t num_operations, F const& f)
+    {
+        std::size_t const num_passes =
+            (std::max)(num_operations / num_elements, std::size_t(1));
+        double const seconds =
+            hpx::benchmark::run_threads(1, [&](std::size_t) {
+                for (std::size_t pass = 0; pass != num_passes; ++pass)
+                    f();
+            });
+
+        hpx::benchmark::report(name,
+            seconds * 1e9 / double(num_passes * num_elements), "ns/op");
+    }
+
+    void flat_storage(std::size_t num_operations)
+    {
+        std::vector<flat_tuple> src(num_elements);
+        for (std::size_t i = 0; i != num_elements; ++i)
+            src[i] = flat_tuple(
+                std::int32_t(i), float(i), double(i), -std::int64_t(i));
+        std::vector<flat_tuple> dest(num_elements);
+
+        measure("flat_storage/copy", num_operations, [&] {
+            std::copy(src.begin(), src.end(), dest.begin());
+            hpx::benchmark::do_not_optimize(dest.data());
+        });
+
+        measure("flat_storage/swap", num_operations, [&] {
+            std::swap_ranges(src.begin(), src.end(), dest.begin());
+            hpx::benchmark::do_not_optimize(dest.data());
+        });
+
+        std::array<float, 8> left{};
+        std::array<float, 8> right{};
+        measure("flat_storage/array_cat", num_operations, [&] {
+            for (std::size_t i = 0; i != num_elements; ++i)
+            {
+                left[0] = float(i);
+                hpx::benchmark::do_not_optimize(left);
+                hpx::benchmark::do_not_optimize(hpx::tuple_cat(left, right));
+            }
+        });
+    }
+
+    void comparison(std::size_t num_operations)
+    {
+        // about half of the pairs are equal, the others differ in a random
+        // element
+        std::uint64_t state = 42;
+        std::vector<key_tuple> lhs(num_elements);
+        std::vector<key_tuple> rhs(num_elements);
+        for (std::size_t i = 0; i != num_elements; ++i)
+        {
+            std::int32_t const v = std::int32_t(xorshift(state) % 1000);
+            lhs[i] = key_tuple(v, v + 1, v + 2, v + 3);
+            rhs[i] = lhs[i];
+            if (xorshift(state) % 2 == 0)
+            {
+                switch (xorshift(state) % 4)
+                {
+                case 0:
+                    hpx::get<0>(rhs[i]) += 1;
+                    break;
+                case 1:
+                    hpx::get<1>(rhs[i]) -= 1;
+                    break;
+                case 2:
+                    hpx::get<2>(rhs[i]) += 1;
+                    break;
+                default:
+                    hpx::get<3>(rhs[i]) -= 1;
+                    break;
+                }
+            }
+        }
+
+        measure("comparison/equal", num_operations, [&] {
+            std::size_t count = 0;
+            for (std::size_t i = 0; i != num_elements; ++i)
+                count += lhs[i] == rhs[i];
+            hpx::benchmark::do_not_optimize(count);
+        });
+
+        measure("comparison/less", num_operations, [&] {
+            std::size_t count = 0;
+            for (std::size_t i = 0; i != num_elements; ++i)
+                count += lhs[i] < rhs[i];
+            hpx::benchmark::do_not_optimize(count);
+        });
+    }
+}    // namespace
+
+int main(int argc, char* argv[])
+{
+    std::size_t const num_operations =
+        hpx::benchmark::operations(argc, argv, 200000000);
+
+    flat_storage(num_operations);
+    comparison(num_operations);
+    return 0;
+}
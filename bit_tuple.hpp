@@ -0,0 +1,377 @@
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// bit_tuple<Fields...> packs small integers, enumerations and bools into as
+// few machine words as possible. Each field is either bool (one bit) or
+// bit_field<T, Width>, storing the lowest Width bits of a T. Fields never
+// straddle words, and records of up to 8, 16 or 32 bits use a single word of
+// that size.
+//
+// The elements are accessed through the usual get<I>, which yields a proxy
+// convertible to (and assignable from) the element type for non-const bit
+// tuples and the element value otherwise. tuple_size and tuple_element work
+// as for any tuple. Equality and std::hash operate on whole words.
+
+#pragma once
+
+#include "try_tuple.hpp"
+
+#include <array>
+#include <climits>
+#include <cstddef>    // for size_t
+#include <cstdint>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <hip/hip_runtime.h>
+
+namespace hpx {
+
+    // Annotates a field of a bit_tuple storing Width bits of a T.
+    template <typename T, std::size_t Width>
+    struct bit_field
+    {
+    };
+
+    template <typename... Fields>
+    class bit_tuple;
+
+    namespace detail {
+
+        template <typename Field>
+        struct bit_field_traits;
+
+        template <typename T, std::size_t Width>
+        struct bit_field_traits<bit_field<T, Width>>
+        {
+            static_assert(std::is_integral<T>::value || std::is_enum<T>::value,
+                "bit fields hold integral or enumeration types");
+            static_assert(Width != 0 && Width <= 64,
+                "bit fields are between 1 and 64 bits wide");
+
+            using type = T;
+            static constexpr std::size_t width = Width;
+        };
+
+        template <>
+        struct bit_field_traits<bool> : bit_field_traits<bit_field<bool, 1>>
+        {
+        };
+
+        // the integral type used to represent T
+        template <typename T, typename Enable = void>
+        struct bit_field_repr
+        {
+            using type = T;
+        };
+
+        template <typename T>
+        struct bit_field_repr<T,
+            typename std::enable_if<std::is_enum<T>::value>::type>
+        {
+            using type = typename std::underlying_type<T>::type;
+        };
+
+        // the smallest unsigned type holding Bits bits, 64 bit words for
+        // anything larger
+        template <std::size_t Bits>
+        struct bit_tuple_word
+        {
+            using type = typename std::conditional<(Bits <= 8), std::uint8_t,
+                typename std::conditional<(Bits <= 16), std::uint16_t,
+                    typename std::conditional<(Bits <= 32), std::uint32_t,
+                        std::uint64_t>::type>::type>::type;
+        };
+
+        struct bit_field_position
+        {
+            std::size_t word;
+            std::size_t offset;
+        };
+
+        template <typename... Fields>
+        struct bit_tuple_layout
+        {
+            static constexpr std::size_t num_fields = sizeof...(Fields);
+            static constexpr std::size_t total_bits =
+                (std::size_t(0) + ... + bit_field_traits<Fields>::width);
+
+            using word_type = typename bit_tuple_word<total_bits>::type;
+            static constexpr std::size_t word_bits =
+                sizeof(word_type) * CHAR_BIT;
+
+            // assigns fields to words in order, starting a new word whenever
+            // the next field does not fit into the current one
+            static constexpr std::array<bit_field_position, num_fields + 1>
+            compute() noexcept
+            {
+                std::size_t const widths[] = {
+                    bit_field_traits<Fields>::width..., 0};
+
+                std::array<bit_field_position, num_fields + 1> result{};
+                std::size_t word = 0;
+                std::size_t offset = 0;
+                for (std::size_t i = 0; i != num_fields; ++i)
+                {
+                    if (offset + widths[i] > word_bits)
+                    {
+                        ++word;
+                        offset = 0;
+                    }
+                    result[i] = bit_field_position{word, offset};
+                    offset += widths[i];
+                }
+                // the last entry holds the number of words
+                result[num_fields] =
+                    bit_field_position{offset != 0 ? word + 1 : word, 0};
+                return result;
+            }
+
+            static constexpr std::array<bit_field_position, num_fields + 1>
+                positions = compute();
+
+            static constexpr std::size_t num_words =
+                positions[num_fields].word != 0 ?
+                positions[num_fields].word :
+                1;
+        };
+
+        template <typename Word, std::size_t Width>
+        struct bit_field_mask
+          : std::integral_constant<Word,
+                (Width >= sizeof(Word) * CHAR_BIT ?
+                        Word(~Word(0)) :
+                        Word((Word(1) << Width) - 1))>
+        {
+        };
+
+        template <typename T, std::size_t Offset, std::size_t Width,
+            typename Word>
+        constexpr __host__ __device__ inline T bit_field_load(
+            Word word) noexcept
+        {
+            using repr = typename bit_field_repr<T>::type;
+            using unsigned_repr = typename std::make_unsigned<
+                typename std::conditional<std::is_same<repr, bool>::value,
+                    unsigned char, repr>::type>::type;
+
+            unsigned_repr bits = static_cast<unsigned_repr>(
+                (word >> Offset) & bit_field_mask<Word, Width>::value);
+
+            if constexpr (std::is_signed<repr>::value &&
+                Width < sizeof(repr) * CHAR_BIT)
+            {
+                // sign extend negative values
+                unsigned_repr const sign = unsigned_repr(1) << (Width - 1);
+                bits = static_cast<unsigned_repr>((bits ^ sign) - sign);
+            }
+            return static_cast<T>(static_cast<repr>(bits));
+        }
+
+        template <std::size_t Offset, std::size_t Width, typename Word,
+            typename T>
+        constexpr __host__ __device__ inline Word bit_field_store(
+            Word word, T value) noexcept
+        {
+            using repr = typename bit_field_repr<T>::type;
+            constexpr Word mask = bit_field_mask<Word, Width>::value;
+
+            Word const bits = static_cast<Word>(static_cast<repr>(value));
+            return static_cast<Word>((word & ~Word(mask << Offset)) |
+                Word((bits & mask) << Offset));
+        }
+    }    // namespace detail
+
+    // Refers to a field of a non-const bit_tuple.
+    template <typename T, typename Word, std::size_t Offset, std::size_t Width>
+    class bit_field_reference
+    {
+    public:
+        explicit constexpr __host__ __device__ bit_field_reference(
+            Word& word) noexcept
+          : _word(word)
+        {
+        }
+
+        bit_field_reference(bit_field_reference const&) = default;
+
+        constexpr __host__ __device__ operator T() const noexcept
+        {
+            return detail::bit_field_load<T, Offset, Width>(_word);
+        }
+
+        constexpr __host__ __device__ bit_field_reference const& operator=(
+            T value) const noexcept
+        {
+            _word = detail::bit_field_store<Offset, Width>(_word, value);
+            return *this;
+        }
+
+        // assigns the referenced value, not the reference
+        constexpr __host__ __device__ bit_field_reference const& operator=(
+            bit_field_reference const& other) const noexcept
+        {
+            return *this = static_cast<T>(other);
+        }
+
+    private:
+        Word& _word;
+    };
+
+    template <typename... Fields>
+    class bit_tuple
+    {
+        using layout = detail::bit_tuple_layout<Fields...>;
+
+    public:
+        using word_type = typename layout::word_type;
+        static constexpr std::size_t num_words = layout::num_words;
+
+        template <std::size_t I>
+        using value_type = typename detail::bit_field_traits<
+            typename util::at_index<I, Fields...>::type>::type;
+
+        template <std::size_t I>
+        using reference = bit_field_reference<value_type<I>, word_type,
+            layout::positions[I].offset,
+            detail::bit_field_traits<
+                typename util::at_index<I, Fields...>::type>::width>;
+
+    private:
+        template <std::size_t... Is, typename... Ts>
+        constexpr __host__ __device__ bit_tuple(
+            util::index_pack<Is...>, Ts const&... vs) noexcept
+          : _words{}
+        {
+            ((this->template get<Is>() = vs), ...);
+        }
+
+    public:
+        // all fields are zero
+        constexpr __host__ __device__ bit_tuple() noexcept
+          : _words{}
+        {
+        }
+
+        template <std::size_t N = sizeof...(Fields),
+            typename Enable = typename std::enable_if<N != 0>::type>
+        explicit constexpr __host__ __device__ bit_tuple(
+            typename detail::bit_field_traits<Fields>::type const&... vs)
+            noexcept
+          : bit_tuple(
+                typename util::make_index_pack<sizeof...(Fields)>::type{},
+                vs...)
+        {
+        }
+
+        template <std::size_t I>
+        constexpr __host__ __device__ reference<I> get() noexcept
+        {
+            return reference<I>(_words[layout::positions[I].word]);
+        }
+
+        template <std::size_t I>
+        constexpr __host__ __device__ value_type<I> get() const noexcept
+        {
+            return detail::bit_field_load<value_type<I>,
+                layout::positions[I].offset,
+                detail::bit_field_traits<
+                    typename util::at_index<I, Fields...>::type>::width>(
+                _words[layout::positions[I].word]);
+        }
+
+        // the packed representation, bits not used by any field are zero
+        constexpr __host__ __device__ std::array<word_type, num_words> const&
+        words() const noexcept
+        {
+            return _words;
+        }
+
+        friend constexpr __host__ __device__ bool operator==(
+            bit_tuple const& lhs, bit_tuple const& rhs) noexcept
+        {
+            for (std::size_t i = 0; i != num_words; ++i)
+            {
+                if (lhs._words[i] != rhs._words[i])
+                    return false;
+            }
+            return true;
+        }
+
+        friend constexpr __host__ __device__ bool operator!=(
+            bit_tuple const& lhs, bit_tuple const& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+
+    private:
+        std::array<word_type, num_words> _words;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename... Fields>
+    struct tuple_size<bit_tuple<Fields...>>
+      : std::integral_constant<std::size_t, sizeof...(Fields)>
+    {
+    };
+
+    // The element access used by the generic overloads of hpx::get, which
+    // yield proxies for non-const bit tuples and values otherwise.
+    template <std::size_t I, typename... Fields>
+    struct tuple_element<I, bit_tuple<Fields...>>
+    {
+        using type =
+            typename bit_tuple<Fields...>::template value_type<I>;
+
+        static constexpr __host__ __device__ inline
+            typename bit_tuple<Fields...>::template reference<I>
+            get(bit_tuple<Fields...>& tuple) noexcept
+        {
+            return tuple.template get<I>();
+        }
+
+        static constexpr __host__ __device__ inline type get(
+            bit_tuple<Fields...> const& tuple) noexcept
+        {
+            return tuple.template get<I>();
+        }
+    };
+}    // namespace hpx
+
+namespace std {
+
+    template <typename... Fields>
+    struct tuple_size<hpx::bit_tuple<Fields...>>
+      : std::integral_constant<std::size_t, sizeof...(Fields)>
+    {
+    };
+
+    template <std::size_t I, typename... Fields>
+    struct tuple_element<I, hpx::bit_tuple<Fields...>>
+    {
+        using type =
+            typename hpx::bit_tuple<Fields...>::template value_type<I>;
+    };
+
+    template <typename... Fields>
+    struct hash<hpx::bit_tuple<Fields...>>
+    {
+        std::size_t operator()(
+            hpx::bit_tuple<Fields...> const& t) const noexcept
+        {
+            using word_type = typename hpx::bit_tuple<Fields...>::word_type;
+
+            std::size_t seed = 0;
+            for (word_type word : t.words())
+            {
+                seed ^= std::hash<word_type>()(word) +
+                    std::size_t(0x9e3779b97f4a7c15ull) + (seed << 6) +
+                    (seed >> 2);
+            }
+            return seed;
+        }
+    };
+}    // namespace std
@@ -0,0 +1,12 @@
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Stand-in for hip/hip_runtime.h used when building without a HIP
+// installation. The headers then only run on the host and the execution
+// space qualifiers are defined away.
+
+#pragma once
+
+#define __host__
+#define __device__
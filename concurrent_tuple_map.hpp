@@ -0,0 +1,286 @@
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// concurrent_tuple_map<Key, Value> is a hash map keyed by hpx::tuple's which
+// can be used concurrently from many threads. The map is split into shards,
+// each guarded by its own reader/writer lock and holding a linear-probing
+// (open addressing) table. All lookup functions accept any tuple which
+// tuple_hash and tuple_equal treat like the key type, i.e. whose elements
+// have the decayed types of the key elements or are strings where the key
+// holds strings. This allows probing with forward_as_tuple(...) without
+// constructing an owning key; arithmetic elements have to match exactly,
+// probing a tuple<double> key with forward_as_tuple(1) misses.
+
+#pragma once
+
+#include "try_tuple.hpp"
+#include "tuple_hash.hpp"
+
+#include <cstddef>    // for size_t
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx {
+
+    template <typename Key, typename Value, typename Hash = tuple_hash,
+        typename KeyEqual = tuple_equal>
+    class concurrent_tuple_map
+    {
+    public:
+        using key_type = Key;
+        using mapped_type = Value;
+        using value_type = std::pair<Key, Value>;
+        using hasher = Hash;
+        using key_equal = KeyEqual;
+
+    private:
+        struct slot
+        {
+            std::uint64_t hash;
+            value_type value;
+        };
+
+        // shards are aligned to avoid false sharing between their locks
+        struct alignas(64) shard
+        {
+            mutable std::shared_mutex mtx;
+            std::vector<std::optional<slot>> slots;
+            std::size_t count = 0;
+        };
+
+        // both the shard and the slot index are derived from the hash
+        template <typename K>
+        std::uint64_t hash_of(K const& key) const
+        {
+            return detail::tuple_hash_mix(
+                static_cast<std::uint64_t>(hash_(key)));
+        }
+
+        shard& shard_of(std::uint64_t hash) const noexcept
+        {
+            return shards_[(hash >> 32) & (num_shards_ - 1)];
+        }
+
+        // Returns the position of the slot holding key, or the position of
+        // the empty slot terminating the probe sequence.
+        template <typename K>
+        std::size_t probe(
+            shard const& s, std::uint64_t hash, K const& key) const
+        {
+            std::size_t const mask = s.slots.size() - 1;
+            std::size_t pos = static_cast<std::size_t>(hash) & mask;
+            while (s.slots[pos] &&
+                !(s.slots[pos]->hash == hash &&
+                    equal_(s.slots[pos]->value.first, key)))
+            {
+                pos = (pos + 1) & mask;
+            }
+            return pos;
+        }
+
+        static void grow(shard& s)
+        {
+            std::vector<std::optional<slot>> slots(s.slots.size() * 2);
+            std::size_t const mask = slots.size() - 1;
+            for (auto& sl : s.slots)
+            {
+                if (!sl)
+                    continue;
+
+                std::size_t pos = static_cast<std::size_t>(sl->hash) & mask;
+                while (slots[pos])
+                    pos = (pos + 1) & mask;
+                slots[pos] = std::move(sl);
+            }
+            s.slots = std::move(slots);
+        }
+
+        // Must be called with the shard locked exclusively. Returns the
+        // position of the slot for key and whether it was newly created.
+        template <typename K, typename... Args>
+        std::pair<std::size_t, bool> emplace_locked(
+            shard& s, std::uint64_t hash, K&& key, Args&&... args)
+        {
+            std::size_t pos = probe(s, hash, key);
+            if (s.slots[pos])
+                return std::make_pair(pos, false);
+
+            // keep the load factor at or below 1/2
+            if (2 * (s.count + 1) > s.slots.size())
+            {
+                grow(s);
+                pos = probe(s, hash, key);
+            }
+
+            s.slots[pos].emplace(slot{hash,
+                value_type(std::piecewise_construct,
+                    std::forward_as_tuple(std::forward<K>(key)),
+                    std::forward_as_tuple(std::forward<Args>(args)...))});
+            ++s.count;
+            return std::make_pair(pos, true);
+        }
+
+    public:
+        // The number of shards is rounded up to a power of two.
+        explicit concurrent_tuple_map(std::size_t num_shards = 64,
+            std::size_t initial_shard_capacity = 16, Hash const& hash = Hash(),
+            KeyEqual const& equal = KeyEqual())
+          : num_shards_(1)
+          , hash_(hash)
+          , equal_(equal)
+        {
+            while (num_shards_ < num_shards)
+                num_shards_ *= 2;
+
+            std::size_t capacity = 2;
+            while (capacity < initial_shard_capacity)
+                capacity *= 2;
+
+            shards_.reset(new shard[num_shards_]);
+            for (std::size_t i = 0; i != num_shards_; ++i)
+                shards_[i].slots.resize(capacity);
+        }
+
+        concurrent_tuple_map(concurrent_tuple_map const&) = delete;
+        concurrent_tuple_map& operator=(concurrent_tuple_map const&) = delete;
+
+        // Inserts (key, value) unless an element with an equal key exists.
+        // Returns whether the element was inserted.
+        template <typename... Args>
+        bool try_emplace(Key key, Args&&... args)
+        {
+            std::uint64_t const hash = hash_of(key);
+            shard& s = shard_of(hash);
+
+            std::unique_lock<std::shared_mutex> l(s.mtx);
+            return emplace_locked(
+                s, hash, std::move(key), std::forward<Args>(args)...)
+                .second;
+        }
+
+        bool insert(Key key, Value value)
+        {
+            return try_emplace(std::move(key), std::move(value));
+        }
+
+        // Returns whether a new element was inserted, otherwise the existing
+        // value was replaced.
+        bool insert_or_assign(Key key, Value value)
+        {
+            std::uint64_t const hash = hash_of(key);
+            shard& s = shard_of(hash);
+
+            std::unique_lock<std::shared_mutex> l(s.mtx);
+            std::size_t const pos = probe(s, hash, key);
+            if (s.slots[pos])
+            {
+                s.slots[pos]->value.second = std::move(value);
+                return false;
+            }
+            return emplace_locked(s, hash, std::move(key), std::move(value))
+                .second;
+        }
+
+        // Calls f(value&) for the element equal to key while holding the
+        // lock of its shard exclusively. Returns whether such element exists.
+        template <typename K, typename F>
+        bool visit(K const& key, F&& f)
+        {
+            std::uint64_t const hash = hash_of(key);
+            shard& s = shard_of(hash);
+
+            std::unique_lock<std::shared_mutex> l(s.mtx);
+            std::size_t const pos = probe(s, hash, key);
+            if (!s.slots[pos])
+                return false;
+
+            f(s.slots[pos]->value.second);
+            return true;
+        }
+
+        // Same as visit, but the shard is only locked for reading, so f must
+        // not modify the value.
+        template <typename K, typename F>
+        bool cvisit(K const& key, F&& f) const
+        {
+            std::uint64_t const hash = hash_of(key);
+            shard const& s = shard_of(hash);
+
+            std::shared_lock<std::shared_mutex> l(s.mtx);
+            std::size_t const pos = probe(s, hash, key);
+            if (!s.slots[pos])
+                return false;
+
+            f(static_cast<Value const&>(s.slots[pos]->value.second));
+            return true;
+        }
+
+        // Copies the value of the element equal to key, if any.
+        template <typename K>
+        bool find(K const& key, Value& value) const
+        {
+            return cvisit(key, [&value](Value const& v) { value = v; });
+        }
+
+        template <typename K>
+        bool contains(K const& key) const
+        {
+            return cvisit(key, [](Value const&) {});
+        }
+
+        template <typename K>
+        bool erase(K const& key)
+        {
+            std::uint64_t const hash = hash_of(key);
+            shard& s = shard_of(hash);
+
+            std::unique_lock<std::shared_mutex> l(s.mtx);
+            std::size_t pos = probe(s, hash, key);
+            if (!s.slots[pos])
+                return false;
+
+            // backward shift deletion, moves following elements of the same
+            // probe sequence into the hole instead of leaving tombstones
+            std::size_t const mask = s.slots.size() - 1;
+            s.slots[pos].reset();
+            for (std::size_t next = (pos + 1) & mask; s.slots[next];
+                 next = (next + 1) & mask)
+            {
+                std::size_t const home =
+                    static_cast<std::size_t>(s.slots[next]->hash) & mask;
+                if (((next - home) & mask) >= ((next - pos) & mask))
+                {
+                    s.slots[pos] = std::move(s.slots[next]);
+                    s.slots[next].reset();
+                    pos = next;
+                }
+            }
+            --s.count;
+            return true;
+        }
+
+        // The result is only a snapshot while other threads modify the map.
+        std::size_t size() const
+        {
+            std::size_t result = 0;
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                std::shared_lock<std::shared_mutex> l(shards_[i].mtx);
+                result += shards_[i].count;
+            }
+            return result;
+        }
+
+    private:
+        std::size_t num_shards_;
+        std::unique_ptr<shard[]> shards_;
+        Hash hash_;
+        KeyEqual equal_;
+    };
+}    // namespace hpx
@@ -0,0 +1,71 @@
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "invoke_fused.hpp"
+#include "try_tuple.hpp"
+
+#include <type_traits>
+#include <utility>
+
+#include <hip/hip_runtime.h>
+
+namespace hpx {
+
+    namespace detail {
+
+        template <typename F, typename Args>
+        class deferred;
+
+        // Stores the callable and its bound arguments by value, without any
+        // type erasure, so binding the arguments never allocates. Invoking a
+        // deferred call moves both the callable and the arguments into the
+        // call, it should therefore be invoked only once, a second call sees
+        // the moved-from arguments.
+        template <typename F, typename... Ts>
+        class deferred<F, tuple<Ts...>>
+        {
+        public:
+            // the constraint keeps the constructor from being a better match
+            // than the copy constructor for non-const lvalues of deferred
+            template <typename F_, typename... Ts_,
+                typename Enable = typename std::enable_if<!std::is_same<
+                    typename std::decay<F_>::type, deferred>::value>::type>
+            explicit constexpr __host__ __device__ deferred(F_&& f, Ts_&&... vs)
+              : _f(std::forward<F_>(f))
+              , _args(std::forward<Ts_>(vs)...)
+            {
+            }
+
+            deferred(deferred&&) = default;
+            deferred(deferred const&) = default;
+
+            deferred& operator=(deferred&&) = delete;
+            deferred& operator=(deferred const&) = delete;
+
+            __host__ __device__ inline auto operator()() -> decltype(
+                hpx::invoke_fused(std::declval<F&&>(),
+                    std::declval<tuple<Ts...>&&>()))
+            {
+                return hpx::invoke_fused(std::move(_f), std::move(_args));
+            }
+
+        private:
+            F _f;
+            tuple<Ts...> _args;
+        };
+    }    // namespace detail
+
+    // Binds f and copies (or moves) of vs... into a nullary callable.
+    template <typename F, typename... Ts>
+    constexpr __host__ __device__ inline detail::deferred<
+        typename std::decay<F>::type, tuple<typename std::decay<Ts>::type...>>
+    deferred_call(F&& f, Ts&&... vs)
+    {
+        return detail::deferred<typename std::decay<F>::type,
+            tuple<typename std::decay<Ts>::type...>>(
+            std::forward<F>(f), std::forward<Ts>(vs)...);
+    }
+}    // namespace hpx
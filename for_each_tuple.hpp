@@ -0,0 +1,150 @@
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Batched application of a function to many tuples. for_each_tuple unpacks
+// each tuple of a sequence (array of structures) into the arguments of f,
+// for_each_zipped calls f with the i-th element of each of several columns
+// (structure of arrays). The latter accesses every column with unit stride,
+// which allows the compiler to vectorize the loop.
+//
+// The execution policy selects the backend: seq runs on the calling thread,
+// par splits the range into contiguous chunks processed by a set of threads.
+// Both share the per-element code path, which is __host__ __device__, so
+// that a policy launching a HIP kernel over the same body can be added
+// without changing the callers.
+
+#pragma once
+
+#include "invoke_fused.hpp"
+#include "try_tuple.hpp"
+
+#include <algorithm>
+#include <cstddef>    // for size_t
+#include <iterator>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+
+namespace hpx {
+
+    namespace execution {
+
+        struct sequenced_policy
+        {
+        };
+
+        // Uses num_threads threads, or one per hardware thread if zero.
+        struct parallel_policy
+        {
+            constexpr parallel_policy with(std::size_t n) const noexcept
+            {
+                return parallel_policy{n};
+            }
+
+            std::size_t num_threads = 0;
+        };
+
+        inline constexpr sequenced_policy seq = {};
+        inline constexpr parallel_policy par = {};
+    }    // namespace execution
+
+    namespace detail {
+
+        // Calls f(begin, end) for [0, count) on the calling thread.
+        template <typename F>
+        void for_each_chunked(
+            execution::sequenced_policy, std::size_t count, F const& f)
+        {
+            f(std::size_t(0), count);
+        }
+
+        // Calls f(begin, end) for contiguous chunks of [0, count), one chunk
+        // per thread.
+        template <typename F>
+        void for_each_chunked(
+            execution::parallel_policy policy, std::size_t count, F const& f)
+        {
+            // don't spawn threads for less than this many elements each
+            std::size_t const min_chunk = 1024;
+
+            std::size_t num_threads = policy.num_threads != 0 ?
+                policy.num_threads :
+                (std::max)(std::thread::hardware_concurrency(), 1u);
+            num_threads = (std::min)(num_threads, count / min_chunk);
+            if (num_threads <= 1)
+            {
+                f(std::size_t(0), count);
+                return;
+            }
+
+            std::vector<std::thread> threads;
+            threads.reserve(num_threads - 1);
+            for (std::size_t k = 1; k != num_threads; ++k)
+            {
+                threads.emplace_back(f, count * k / num_threads,
+                    count * (k + 1) / num_threads);
+            }
+            f(std::size_t(0), count / num_threads);
+
+            for (auto& t : threads)
+                t.join();
+        }
+
+        template <typename RandomIt, typename F>
+        __host__ __device__ inline void for_each_tuple_chunk(
+            RandomIt first, std::size_t begin, std::size_t end, F& f)
+        {
+            for (std::size_t i = begin; i != end; ++i)
+                hpx::invoke_fused(f, first[i]);
+        }
+
+        template <std::size_t... Is, typename Columns, typename F>
+        __host__ __device__ inline void for_each_zipped_chunk(
+            util::index_pack<Is...>, Columns const& columns,
+            std::size_t begin, std::size_t end, F& f)
+        {
+            // copy the column iterators to let the compiler know they are not
+            // modified by f
+            Columns const cs = columns;
+            for (std::size_t i = begin; i != end; ++i)
+                f(hpx::get<Is>(cs)[i]...);
+        }
+    }    // namespace detail
+
+    // Calls invoke_fused(f, t) for each tuple t in [first, last). Each
+    // invocation receives the elements of the tuple as separate arguments,
+    // as lvalue references into the sequence. Each chunk works on its own
+    // copy of f.
+    template <typename Policy, typename RandomIt, typename F>
+    void for_each_tuple(Policy policy, RandomIt first, RandomIt last, F f)
+    {
+        detail::for_each_chunked(policy,
+            static_cast<std::size_t>(last - first),
+            [&](std::size_t begin, std::size_t end) {
+                F f_chunk = f;
+                detail::for_each_tuple_chunk(first, begin, end, f_chunk);
+            });
+    }
+
+    // Calls f(get<0>(columns)[i], get<1>(columns)[i], ...) for each i in
+    // [0, count). The columns are random access iterators, for instance
+    // pointers into vectors.
+    template <typename Policy, typename... RandomIts, typename F>
+    void for_each_zipped(Policy policy, tuple<RandomIts...> const& columns,
+        std::size_t count, F f)
+    {
+        detail::for_each_chunked(policy, count,
+            [&](std::size_t begin, std::size_t end) {
+                using indices =
+                    typename util::make_index_pack<sizeof...(RandomIts)>::type;
+
+                F f_chunk = f;
+                detail::for_each_zipped_chunk(
+                    indices{}, columns, begin, end, f_chunk);
+            });
+    }
+}    // namespace hpx
@@ -0,0 +1,386 @@
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Grouping and aggregation of records stored as a structure of arrays, i.e.
+// as a tuple of columns. group_by<KeyIs...>(soa, aggregators...) groups the
+// rows by the key columns KeyIs... and computes each aggregator (sum, min,
+// max or count of a column) per group. The result is again a structure of
+// arrays: a tuple holding one vector per key column followed by one vector
+// per aggregator, with one row per group, in the order in which the groups
+// first appear in soa.
+//
+// The groups are found through an open addressing hash table holding group
+// indices only. Keys are never materialized while grouping, rows are hashed
+// and compared through forward_as_tuple views of their key columns. With the
+// parallel policy each thread aggregates a contiguous part of the rows into
+// its own table, the tables are merged afterwards.
+
+#pragma once
+
+#include "for_each_tuple.hpp"
+#include "try_tuple.hpp"
+#include "tuple_hash.hpp"
+
+#include <algorithm>
+#include <cstddef>    // for size_t
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx {
+
+    namespace detail {
+
+        template <std::size_t I, typename SoA>
+        using column_value_t = typename std::decay<decltype(
+            hpx::get<I>(std::declval<SoA const&>())[0])>::type;
+    }    // namespace detail
+
+    // The aggregators used with group_by. The state of each aggregator is
+    // initialized from the first row of a group, updated with each further
+    // row and merged with the state of the same group computed by another
+    // thread.
+    namespace aggregate {
+
+        // the sum of column I, computed in the element type of the column
+        template <std::size_t I>
+        struct sum
+        {
+            template <typename SoA>
+            using value_type = detail::column_value_t<I, SoA>;
+
+            template <typename SoA>
+            static value_type<SoA> init(SoA const& soa, std::size_t row)
+            {
+                return hpx::get<I>(soa)[row];
+            }
+
+            template <typename T, typename SoA>
+            static void update(T& acc, SoA const& soa, std::size_t row)
+            {
+                acc += hpx::get<I>(soa)[row];
+            }
+
+            template <typename T>
+            static void merge(T& acc, T const& other)
+            {
+                acc += other;
+            }
+        };
+
+        template <std::size_t I>
+        struct min
+        {
+            template <typename SoA>
+            using value_type = detail::column_value_t<I, SoA>;
+
+            template <typename SoA>
+            static value_type<SoA> init(SoA const& soa, std::size_t row)
+            {
+                return hpx::get<I>(soa)[row];
+            }
+
+            template <typename T, typename SoA>
+            static void update(T& acc, SoA const& soa, std::size_t row)
+            {
+                merge(acc, hpx::get<I>(soa)[row]);
+            }
+
+            template <typename T>
+            static void merge(T& acc, T const& other)
+            {
+                if (other < acc)
+                    acc = other;
+            }
+        };
+
+        template <std::size_t I>
+        struct max
+        {
+            template <typename SoA>
+            using value_type = detail::column_value_t<I, SoA>;
+
+            template <typename SoA>
+            static value_type<SoA> init(SoA const& soa, std::size_t row)
+            {
+                return hpx::get<I>(soa)[row];
+            }
+
+            template <typename T, typename SoA>
+            static void update(T& acc, SoA const& soa, std::size_t row)
+            {
+                merge(acc, hpx::get<I>(soa)[row]);
+            }
+
+            template <typename T>
+            static void merge(T& acc, T const& other)
+            {
+                if (acc < other)
+                    acc = other;
+            }
+        };
+
+        // the number of rows in the group
+        struct count
+        {
+            template <typename SoA>
+            using value_type = std::size_t;
+
+            template <typename SoA>
+            static std::size_t init(SoA const&, std::size_t)
+            {
+                return 1;
+            }
+
+            template <typename SoA>
+            static void update(std::size_t& acc, SoA const&, std::size_t)
+            {
+                ++acc;
+            }
+
+            static void merge(std::size_t& acc, std::size_t other)
+            {
+                acc += other;
+            }
+        };
+    }    // namespace aggregate
+
+    namespace detail {
+
+        template <typename SoA, typename KeyIs, typename... Aggregators>
+        class group_table;
+
+        // Maps the key of each row to the index of its group. Each group
+        // is represented by the first row it was seen in, the keys are
+        // compared by looking them up in soa.
+        template <typename SoA, std::size_t... KeyIs, typename... Aggregators>
+        class group_table<SoA, util::index_pack<KeyIs...>, Aggregators...>
+        {
+        public:
+            using state_type =
+                tuple<typename Aggregators::template value_type<SoA>...>;
+            using result_type =
+                tuple<std::vector<column_value_t<KeyIs, SoA>>...,
+                    std::vector<typename Aggregators::template value_type<
+                        SoA>>...>;
+
+        private:
+            using aggregator_indices =
+                typename util::make_index_pack<sizeof...(Aggregators)>::type;
+
+            auto key_of(std::size_t row) const
+            {
+                return hpx::forward_as_tuple(hpx::get<KeyIs>(_soa)[row]...);
+            }
+
+            std::uint64_t hash_of(std::size_t row) const
+            {
+                return tuple_hash_mix(
+                    static_cast<std::uint64_t>(tuple_hash()(key_of(row))));
+            }
+
+            void grow()
+            {
+                // slots hold the group index plus one, zero marks empty slots
+                std::vector<std::size_t> slots(_slots.size() * 2, 0);
+                std::size_t const mask = slots.size() - 1;
+                for (std::size_t g = 0; g != _rows.size(); ++g)
+                {
+                    std::size_t pos =
+                        static_cast<std::size_t>(_hashes[g]) & mask;
+                    while (slots[pos] != 0)
+                        pos = (pos + 1) & mask;
+                    slots[pos] = g + 1;
+                }
+                _slots = std::move(slots);
+            }
+
+            // Returns the index of the group of the key of row, and whether
+            // the group was added.
+            std::pair<std::size_t, bool> find_or_add(
+                std::uint64_t hash, std::size_t row)
+            {
+                std::size_t const mask = _slots.size() - 1;
+                std::size_t pos = static_cast<std::size_t>(hash) & mask;
+                for (; _slots[pos] != 0; pos = (pos + 1) & mask)
+                {
+                    std::size_t const g = _slots[pos] - 1;
+                    if (_hashes[g] == hash && key_of(_rows[g]) == key_of(row))
+                        return std::make_pair(g, false);
+                }
+
+                std::size_t const g = _rows.size();
+                _slots[pos] = g + 1;
+                _hashes.push_back(hash);
+                _rows.push_back(row);
+
+                // keep the load factor at or below 1/2
+                if (2 * _rows.size() > _slots.size())
+                    grow();
+                return std::make_pair(g, true);
+            }
+
+            template <std::size_t... Js>
+            void update(util::index_pack<Js...>, state_type& state,
+                std::size_t row) const
+            {
+                (Aggregators::update(hpx::get<Js>(state), _soa, row), ...);
+            }
+
+            template <std::size_t... Js>
+            static void merge(util::index_pack<Js...>, state_type& state,
+                state_type const& other)
+            {
+                (Aggregators::merge(hpx::get<Js>(state), hpx::get<Js>(other)),
+                    ...);
+            }
+
+            template <std::size_t... Ks, std::size_t... Js>
+            result_type make_result(
+                util::index_pack<Ks...>, util::index_pack<Js...>) const
+            {
+                tuple<std::vector<column_value_t<KeyIs, SoA>>...> keys;
+                tuple<std::vector<
+                    typename Aggregators::template value_type<SoA>>...>
+                    values;
+
+                (hpx::get<Ks>(keys).reserve(_rows.size()), ...);
+                (hpx::get<Js>(values).reserve(_rows.size()), ...);
+                for (std::size_t g = 0; g != _rows.size(); ++g)
+                {
+                    (hpx::get<Ks>(keys).push_back(
+                         hpx::get<KeyIs>(_soa)[_rows[g]]),
+                        ...);
+                    (hpx::get<Js>(values).push_back(
+                         hpx::get<Js>(_states[g])),
+                        ...);
+                }
+                return hpx::tuple_cat(std::move(keys), std::move(values));
+            }
+
+        public:
+            explicit group_table(SoA const& soa)
+              : _soa(soa)
+              , _slots(16, 0)
+            {
+            }
+
+            void aggregate(std::size_t begin, std::size_t end)
+            {
+                for (std::size_t row = begin; row != end; ++row)
+                {
+                    auto const r = find_or_add(hash_of(row), row);
+                    if (r.second)
+                        _states.emplace_back(Aggregators::init(_soa, row)...);
+                    else
+                        update(aggregator_indices{}, _states[r.first], row);
+                }
+            }
+
+            // Adds the groups of other, which refers to the same rows. Groups
+            // not seen before are appended in their order in other.
+            void merge(group_table&& other)
+            {
+                for (std::size_t g = 0; g != other._rows.size(); ++g)
+                {
+                    auto const r =
+                        find_or_add(other._hashes[g], other._rows[g]);
+                    if (r.second)
+                    {
+                        _states.push_back(std::move(other._states[g]));
+                    }
+                    else
+                    {
+                        merge(aggregator_indices{}, _states[r.first],
+                            other._states[g]);
+                    }
+                }
+            }
+
+            result_type result() const
+            {
+                return make_result(
+                    typename util::make_index_pack<sizeof...(KeyIs)>::type{},
+                    aggregator_indices{});
+            }
+
+        private:
+            SoA const& _soa;
+            std::vector<std::size_t> _slots;
+            std::vector<std::uint64_t> _hashes;    // per group
+            std::vector<std::size_t> _rows;        // per group
+            std::vector<state_type> _states;       // per group
+        };
+    }    // namespace detail
+
+    // Groups the rows of soa by the key columns KeyIs... and applies the
+    // aggregators to each group, see above. soa is a tuple of equally sized
+    // random access containers, for instance tie(ids, names, values), e.g.
+    //
+    //     auto [group_ids, totals, counts] = group_by<0>(
+    //         tie(ids, values), aggregate::sum<1>{}, aggregate::count{});
+    template <std::size_t... KeyIs, typename SoA, typename... Aggregators>
+    auto group_by(execution::sequenced_policy, SoA const& soa,
+        Aggregators const&...)
+    {
+        static_assert(
+            sizeof...(KeyIs) != 0, "at least one key column is needed");
+
+        detail::group_table<SoA, util::index_pack<KeyIs...>, Aggregators...>
+            table(soa);
+        table.aggregate(0, hpx::get<0>(soa).size());
+        return table.result();
+    }
+
+    // Same as above, each thread of the policy aggregates a contiguous part
+    // of the rows. The per thread tables are merged in order, which yields
+    // the same order of the groups as the sequential version.
+    template <std::size_t... KeyIs, typename SoA, typename... Aggregators>
+    auto group_by(execution::parallel_policy policy, SoA const& soa,
+        Aggregators const&...)
+    {
+        static_assert(
+            sizeof...(KeyIs) != 0, "at least one key column is needed");
+
+        using table_type = detail::group_table<SoA,
+            util::index_pack<KeyIs...>, Aggregators...>;
+
+        // don't spawn threads for less than this many rows each
+        std::size_t const min_chunk = 16 * 1024;
+        std::size_t const count = hpx::get<0>(soa).size();
+
+        std::size_t num_threads = policy.num_threads != 0 ?
+            policy.num_threads :
+            (std::max)(std::thread::hardware_concurrency(), 1u);
+        num_threads = (std::max)(
+            (std::min)(num_threads, count / min_chunk), std::size_t(1));
+
+        std::vector<table_type> tables(num_threads, table_type(soa));
+        std::vector<std::thread> threads;
+        threads.reserve(num_threads - 1);
+        for (std::size_t k = 1; k != num_threads; ++k)
+        {
+            threads.emplace_back([&, k] {
+                tables[k].aggregate(
+                    count * k / num_threads, count * (k + 1) / num_threads);
+            });
+        }
+        tables[0].aggregate(0, count / num_threads);
+
+        for (auto& t : threads)
+            t.join();
+
+        for (std::size_t k = 1; k != num_threads; ++k)
+            tables[0].merge(std::move(tables[k]));
+        return tables[0].result();
+    }
+
+    template <std::size_t... KeyIs, typename SoA, typename... Aggregators>
+    auto group_by(SoA const& soa, Aggregators const&... aggregators)
+    {
+        return group_by<KeyIs...>(execution::seq, soa, aggregators...);
+    }
+}    // namespace hpx
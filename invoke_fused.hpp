@@ -0,0 +1,49 @@
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "try_tuple.hpp"
+
+#include <cstddef>    // for size_t
+#include <type_traits>
+#include <utility>
+
+#include <hip/hip_runtime.h>
+
+namespace hpx {
+
+    namespace detail {
+
+        template <typename Tuple>
+        struct fused_index_pack
+          : util::make_index_pack<
+                tuple_size<typename std::decay<Tuple>::type>::value>
+        {
+        };
+
+        template <std::size_t... Is, typename F, typename Tuple>
+        constexpr __host__ __device__ inline auto invoke_fused_impl(
+            util::index_pack<Is...>, F&& f, Tuple&& t)
+            -> decltype(std::forward<F>(f)(
+                hpx::get<Is>(std::forward<Tuple>(t))...))
+        {
+            return std::forward<F>(f)(hpx::get<Is>(std::forward<Tuple>(t))...);
+        }
+    }    // namespace detail
+
+    // Invokes f with the elements of the tuple-like t as its arguments. The
+    // elements are forwarded with the value category of t, so an rvalue
+    // tuple passes its elements on as rvalues.
+    template <typename F, typename Tuple>
+    constexpr __host__ __device__ inline auto invoke_fused(F&& f, Tuple&& t)
+        -> decltype(detail::invoke_fused_impl(
+            typename detail::fused_index_pack<Tuple>::type{},
+            std::forward<F>(f), std::forward<Tuple>(t)))
+    {
+        return detail::invoke_fused_impl(
+            typename detail::fused_index_pack<Tuple>::type{},
+            std::forward<F>(f), std::forward<Tuple>(t));
+    }
+}    // namespace hpx
@@ -1,5 +1,184 @@
 #include <iostream>
-#include "try_tuple_solution1.hpp"
+#include "try_tuple.hpp"
+
+#include <array>
+#include <cstddef>    // for size_t
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// element access for all cv- and ref-qualifications of the supported
+// tuple-like types
+template <typename Tuple, typename Expected>
+constexpr bool get_yields()
+{
+    return std::is_same<decltype(hpx::get<0>(std::declval<Tuple>())),
+        Expected>::value;
+}
+
+static_assert(get_yields<std::array<int, 3>&, int&>(), "");
+static_assert(get_yields<std::array<int, 3> const&, int const&>(), "");
+static_assert(get_yields<std::array<int, 3>&&, int&&>(), "");
+static_assert(get_yields<std::array<int, 3> const&&, int const&&>(), "");
+
+static_assert(get_yields<std::array<int const, 3>&, int const&>(), "");
+static_assert(get_yields<std::array<int const, 3> const&, int const&>(), "");
+static_assert(get_yields<std::array<int const, 3>&&, int const&&>(), "");
+static_assert(
+    get_yields<std::array<int const, 3> const&&, int const&&>(), "");
+
+static_assert(get_yields<std::pair<int, char>&, int&>(), "");
+static_assert(get_yields<std::pair<int, char> const&, int const&>(), "");
+static_assert(get_yields<std::pair<int, char>&&, int&&>(), "");
+static_assert(get_yields<std::pair<int, char> const&&, int const&&>(), "");
+
+static_assert(get_yields<hpx::tuple<int, char>&, int&>(), "");
+static_assert(get_yields<hpx::tuple<int, char> const&, int const&>(), "");
+static_assert(get_yields<hpx::tuple<int, char>&&, int&&>(), "");
+static_assert(get_yields<hpx::tuple<int, char> const&&, int const&&>(), "");
+
+static_assert(get_yields<hpx::tuple<int&> const&, int&>(), "");
+static_assert(get_yields<hpx::tuple<int&&>&&, int&&>(), "");
+
+// types implementing the std tuple protocol: std::tuple and a user record
+// specializing std::tuple_size/std::tuple_element, with get found by ADL
+namespace app {
+    struct record
+    {
+        int id;
+        char tag;
+    };
+
+    template <std::size_t I>
+    constexpr auto& get(record& r) noexcept
+    {
+        if constexpr (I == 0)
+            return r.id;
+        else
+            return r.tag;
+    }
+
+    template <std::size_t I>
+    constexpr auto const& get(record const& r) noexcept
+    {
+        if constexpr (I == 0)
+            return r.id;
+        else
+            return r.tag;
+    }
+}    // namespace app
+
+namespace std {
+    template <>
+    struct tuple_size<app::record> : std::integral_constant<std::size_t, 2>
+    {
+    };
+
+    template <std::size_t I>
+    struct tuple_element<I, app::record> : std::conditional<I == 0, int, char>
+    {
+    };
+}    // namespace std
+
+static_assert(get_yields<std::tuple<int, char>&, int&>(), "");
+static_assert(get_yields<std::tuple<int, char> const&, int const&>(), "");
+static_assert(get_yields<std::tuple<int, char>&&, int&&>(), "");
+static_assert(get_yields<std::tuple<int, char> const&&, int const&&>(), "");
+
+static_assert(get_yields<app::record&, int&>(), "");
+static_assert(get_yields<app::record const&, int const&>(), "");
+static_assert(get_yields<app::record&&, int&&>(), "");
+static_assert(get_yields<app::record const&&, int const&&>(), "");
+
+static_assert(std::is_same<decltype(hpx::tuple_cat(
+                               std::declval<std::tuple<int, char>>(),
+                               std::declval<app::record const&>())),
+                  hpx::tuple<int, char, int, char>>::value,
+    "");
+static_assert(hpx::tuple_cat(std::tuple<int, char>(1, 'a'),
+                  app::record{2, 'b'}) ==
+        hpx::tuple<int, char, int, char>(1, 'a', 2, 'b'),
+    "");
+
+// hpx::tuple implements the std tuple protocol itself
+static_assert(std::tuple_size<hpx::tuple<int, char>>::value == 2, "");
+static_assert(std::is_same<std::tuple_element<1, hpx::tuple<int, char>>::type,
+                  char>::value,
+    "");
+static_assert(std::is_same<decltype(std::get<0>(
+                               std::declval<hpx::tuple<int, char>&>())),
+                  int&>::value,
+    "");
+static_assert(std::is_same<decltype(std::get<0>(
+                               std::declval<hpx::tuple<int, char>&&>())),
+                  int&&>::value,
+    "");
+
+constexpr int bound()
+{
+    hpx::tuple<int, char> t(4, 'b');
+    auto& [i, c] = t;
+    i += 1;
+    return hpx::get<0>(t) * 100 + (c - 'a');
+}
+
+static_assert(bound() == 501, "");
+
+// the forwarding constructor requires every element to be constructible
+// from its argument
+static_assert(
+    !std::is_constructible<hpx::tuple<int>, std::string>::value, "");
+static_assert(!std::is_constructible<hpx::tuple<int, int>, std::string,
+                  std::string>::value,
+    "");
+static_assert(
+    std::is_constructible<hpx::tuple<std::string>, char const*>::value, "");
+
+// concatenating arrays of const elements
+constexpr std::array<int const, 1> const_array1{{1}};
+constexpr std::array<int const, 2> const_array2{{2, 3}};
+
+static_assert(hpx::tuple_cat(const_array1, const_array2)[2] == 3, "");
+static_assert(hpx::tuple_cat(std::array<int const, 1>{{1}},
+                  std::array<int const, 2>{{2, 3}})[2] == 3,
+    "");
+static_assert(std::is_same<decltype(hpx::tuple_cat(
+                               const_array1, const_array2)),
+                  std::array<int const, 3>>::value,
+    "");
+
+// construction, assignment, swap and the creation functions in constant
+// expressions
+constexpr hpx::tuple<int, char> swapped()
+{
+    hpx::tuple<int, char> t(1, 'a');
+    hpx::tuple<int, char> u(2, 'b');
+    hpx::swap(t, u);
+    t = u;
+    u = hpx::tuple<long, char>(3, 'c');
+    return u;
+}
+
+constexpr int unpacked()
+{
+    int a = 0;
+    int b = 0;
+    hpx::tie(a, hpx::ignore, b) = hpx::tuple<int, int, int>(1, 2, 3);
+    hpx::get<0>(hpx::forward_as_tuple(a)) += 10;
+    return a * 100 + b;
+}
+
+static_assert(swapped() == hpx::tuple<int, char>(3, 'c'), "");
+static_assert(unpacked() == 1103, "");
+static_assert(hpx::tuple_cat(hpx::tuple<int>(1), std::array<int, 2>{{2, 3}}) ==
+        hpx::tuple<int, int, int>(1, 2, 3),
+    "");
+static_assert(hpx::tuple_cat(std::array<int, 1>{{1}},
+                  std::array<int, 2>{{2, 3}})[2] == 3,
+    "");
+static_assert(hpx::tuple<int, char>(1, 'a') < hpx::tuple<long, char>(1, 'b'),
+    "");
 
 int main()
 {
@@ -0,0 +1,290 @@
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compile-time lists of types (pack) and of values (pack_c, index_pack) and
+// the algorithms operating on them. All algorithms keep the template
+// instantiation depth logarithmic (or constant) in the length of the packs,
+// so that they remain usable with packs of several hundred elements.
+
+#pragma once
+
+#include <cstddef>    // for size_t
+#include <type_traits>
+
+namespace hpx { namespace util {
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename... Ts>
+    struct pack
+    {
+        using type = pack;
+        static constexpr std::size_t size = sizeof...(Ts);
+    };
+
+    template <typename T, T... Vs>
+    struct pack_c
+    {
+        using type = pack_c;
+        static constexpr std::size_t size = sizeof...(Vs);
+    };
+
+    template <std::size_t... Is>
+    using index_pack = pack_c<std::size_t, Is...>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+
+        template <typename Left, typename Right>
+        struct make_index_pack_join;
+
+        template <std::size_t... Left, std::size_t... Right>
+        struct make_index_pack_join<index_pack<Left...>, index_pack<Right...>>
+          : index_pack<Left..., (sizeof...(Left) + Right)...>
+        {
+        };
+    }    // namespace detail
+
+    // make_index_pack<N>::type is index_pack<0, 1, ..., N - 1>
+#if defined(__has_builtin)
+#if __has_builtin(__make_integer_seq)
+#define HPX_HAVE_BUILTIN_MAKE_INTEGER_SEQ
+#elif __has_builtin(__integer_pack)
+#define HPX_HAVE_BUILTIN_INTEGER_PACK
+#endif
+#endif
+
+#if defined(HPX_HAVE_BUILTIN_MAKE_INTEGER_SEQ)
+    template <std::size_t N>
+    struct make_index_pack : __make_integer_seq<pack_c, std::size_t, N>
+    {
+    };
+#elif defined(HPX_HAVE_BUILTIN_INTEGER_PACK)
+    template <std::size_t N>
+    struct make_index_pack : index_pack<__integer_pack(N)...>
+    {
+    };
+#else
+    // splits the range in halves, the depth of the instantiations is log(N)
+    template <std::size_t N>
+    struct make_index_pack
+      : detail::make_index_pack_join<typename make_index_pack<N / 2>::type,
+            typename make_index_pack<N - N / 2>::type>
+    {
+    };
+
+    template <>
+    struct make_index_pack<0> : index_pack<>
+    {
+    };
+
+    template <>
+    struct make_index_pack<1> : index_pack<0>
+    {
+    };
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    // at_index<I, Ts...>::type is the I-th type of Ts, it has no member type
+    // if I is out of range. The lookup is done by overload resolution instead
+    // of recursion.
+    namespace detail {
+
+        template <std::size_t I, typename T>
+        struct indexed
+        {
+            using type = T;
+        };
+
+        template <typename Ts, typename Is>
+        struct indexer;
+
+        template <typename... Ts, std::size_t... Is>
+        struct indexer<pack<Ts...>, index_pack<Is...>> : indexed<Is, Ts>...
+        {
+        };
+
+        template <std::size_t J, typename T>
+        indexed<J, T> at_index_check(indexed<J, T> const*);
+
+        template <std::size_t J>
+        void at_index_check(...);
+
+        template <typename Result>
+        struct at_index_result
+        {
+        };
+
+        template <std::size_t J, typename T>
+        struct at_index_result<indexed<J, T>>
+        {
+            using type = T;
+        };
+    }    // namespace detail
+
+    template <std::size_t I, typename... Ts>
+    struct at_index
+      : detail::at_index_result<decltype(detail::at_index_check<I>(
+            static_cast<detail::indexer<pack<Ts...>,
+                typename make_index_pack<sizeof...(Ts)>::type>*>(nullptr)))>
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // index_of<T, pack<Ts...>>::value is the index of the first occurrence of
+    // T in Ts, or sizeof...(Ts) if there is none.
+    namespace detail {
+
+        template <typename T, typename... Ts>
+        constexpr std::size_t index_of_impl() noexcept
+        {
+            constexpr bool matches[] = {std::is_same<T, Ts>::value..., false};
+            std::size_t i = 0;
+            while (i != sizeof...(Ts) && !matches[i])
+                ++i;
+            return i;
+        }
+    }    // namespace detail
+
+    template <typename T, typename Pack>
+    struct index_of;
+
+    template <typename T, typename... Ts>
+    struct index_of<T, pack<Ts...>>
+      : std::integral_constant<std::size_t,
+            detail::index_of_impl<T, Ts...>()>
+    {
+    };
+
+    // The number of occurrences of T in Ts.
+    template <typename T, typename Pack>
+    struct count_of;
+
+    template <typename T, typename... Ts>
+    struct count_of<T, pack<Ts...>>
+      : std::integral_constant<std::size_t,
+            (std::size_t(0) + ... + std::size_t(std::is_same<T, Ts>::value))>
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // concat<Packs...>::type joins the elements of all Packs, which are either
+    // all pack's or all pack_c's of the same value type. Neighbouring packs
+    // are joined pairwise, halving their number in each round.
+    namespace detail {
+
+        struct concat_none
+        {
+        };
+
+        template <typename Left, typename Right>
+        struct concat_two;
+
+        template <typename... Ts, typename... Us>
+        struct concat_two<pack<Ts...>, pack<Us...>>
+        {
+            using type = pack<Ts..., Us...>;
+        };
+
+        template <typename T, T... Ts, T... Us>
+        struct concat_two<pack_c<T, Ts...>, pack_c<T, Us...>>
+        {
+            using type = pack_c<T, Ts..., Us...>;
+        };
+
+        template <typename Left>
+        struct concat_two<Left, concat_none>
+        {
+            using type = Left;
+        };
+
+        template <typename Packs, typename Is>
+        struct concat_round;
+
+        template <typename... Packs, std::size_t... Is>
+        struct concat_round<pack<Packs...>, index_pack<Is...>>
+        {
+            using type = pack<typename concat_two<
+                typename at_index<2 * Is, Packs...>::type,
+                typename at_index<2 * Is + 1, Packs...>::type>::type...>;
+        };
+
+        template <typename Packs>
+        struct concat_impl;
+
+        template <>
+        struct concat_impl<pack<>>
+        {
+            using type = pack<>;
+        };
+
+        template <typename Pack>
+        struct concat_impl<pack<Pack>>
+        {
+            using type = Pack;
+        };
+
+        template <typename... Packs>
+        struct concat_impl<pack<Packs...>>
+          : concat_impl<typename concat_round<
+                typename std::conditional<sizeof...(Packs) % 2 == 0,
+                    pack<Packs...>, pack<Packs..., concat_none>>::type,
+                typename make_index_pack<(sizeof...(Packs) + 1) /
+                    2>::type>::type>
+        {
+        };
+    }    // namespace detail
+
+    template <typename... Packs>
+    struct concat : detail::concat_impl<pack<Packs...>>
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // filter<Pred, pack<Ts...>>::type is the pack of all Ts for which
+    // Pred<T>::value is true, in their original order.
+    template <template <typename> class Pred, typename Pack>
+    struct filter;
+
+    template <template <typename> class Pred, typename... Ts>
+    struct filter<Pred, pack<Ts...>>
+      : concat<typename std::conditional<Pred<Ts>::value, pack<Ts>,
+            pack<>>::type...>
+    {
+    };
+
+    // unique<pack<Ts...>>::type keeps the first occurrence of each of Ts.
+    namespace detail {
+
+        template <typename Pack, typename Is>
+        struct unique_impl;
+
+        template <typename... Ts, std::size_t... Is>
+        struct unique_impl<pack<Ts...>, index_pack<Is...>>
+          : concat<typename std::conditional<
+                index_of<Ts, pack<Ts...>>::value == Is, pack<Ts>,
+                pack<>>::type...>
+        {
+        };
+    }    // namespace detail
+
+    template <typename Pack>
+    struct unique;
+
+    template <typename... Ts>
+    struct unique<pack<Ts...>>
+      : detail::unique_impl<pack<Ts...>,
+            typename make_index_pack<sizeof...(Ts)>::type>
+    {
+    };
+
+    // Instantiates Template with the elements of Pack.
+    template <template <typename...> class Template, typename Pack>
+    struct rebind_pack;
+
+    template <template <typename...> class Template, typename... Ts>
+    struct rebind_pack<Template, pack<Ts...>>
+    {
+        using type = Template<Ts...>;
+    };
+}}    // namespace hpx::util
@@ -0,0 +1,140 @@
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// padded_tuple<Ts...> places each of its elements on its own cache line, so
+// that elements updated by different threads (e.g. per-worker counters) do
+// not share a line and do not invalidate each other's caches. Apart from its
+// size and alignment it behaves like tuple<Ts...>: the elements are accessed
+// using get<I> and tuple_size/tuple_element work as for any tuple.
+
+#pragma once
+
+#include "try_tuple.hpp"
+
+#include <cstddef>    // for size_t
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <hip/hip_runtime.h>
+
+namespace hpx {
+
+    // The size of a cache line, the minimal distance between objects
+    // modified by different threads.
+#if defined(__cpp_lib_hardware_interference_size)
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winterference-size"
+#endif
+    inline constexpr std::size_t cache_line_size =
+        std::hardware_destructive_interference_size;
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#else
+    inline constexpr std::size_t cache_line_size = 64;
+#endif
+
+    namespace detail {
+
+        template <typename T>
+        struct alignas(cache_line_size) padded_element
+        {
+            constexpr __host__ __device__ padded_element()
+              : value()
+            {
+            }
+
+            template <typename U>
+            explicit constexpr __host__ __device__ padded_element(U&& u)
+              : value(std::forward<U>(u))
+            {
+            }
+
+            T value;
+        };
+    }    // namespace detail
+
+    template <typename... Ts>
+    class padded_tuple
+    {
+    public:    // exposition-only
+        tuple<detail::padded_element<Ts>...> _impl;
+
+    public:
+        constexpr __host__ __device__ padded_tuple()
+          : _impl()
+        {
+        }
+
+        template <typename U, typename... Us,
+            typename Enable = typename std::enable_if<
+                sizeof...(Us) + 1 == sizeof...(Ts) &&
+                (sizeof...(Us) != 0 ||
+                    !std::is_same<padded_tuple,
+                        typename std::decay<U>::type>::value)>::type>
+        explicit constexpr __host__ __device__ padded_tuple(
+            U&& v, Us&&... vs)
+          : _impl(std::forward<U>(v), std::forward<Us>(vs)...)
+        {
+        }
+
+        template <std::size_t I>
+        constexpr __host__ __device__ typename util::at_index<I, Ts...>::type&
+        get() noexcept
+        {
+            return hpx::get<I>(_impl).value;
+        }
+
+        template <std::size_t I>
+        constexpr __host__ __device__
+            typename util::at_index<I, Ts...>::type const&
+            get() const noexcept
+        {
+            return hpx::get<I>(_impl).value;
+        }
+    };
+
+    template <typename... Ts>
+    struct tuple_size<padded_tuple<Ts...>>
+      : std::integral_constant<std::size_t, sizeof...(Ts)>
+    {
+    };
+
+    template <std::size_t I, typename... Ts>
+    struct tuple_element<I, padded_tuple<Ts...>>
+    {
+        using type = typename util::at_index<I, Ts...>::type;
+
+        static constexpr __host__ __device__ inline type& get(
+            padded_tuple<Ts...>& tuple) noexcept
+        {
+            return tuple.template get<I>();
+        }
+
+        static constexpr __host__ __device__ inline type const& get(
+            padded_tuple<Ts...> const& tuple) noexcept
+        {
+            return tuple.template get<I>();
+        }
+    };
+}    // namespace hpx
+
+namespace std {
+
+    template <typename... Ts>
+    struct tuple_size<hpx::padded_tuple<Ts...>>
+      : std::integral_constant<std::size_t, sizeof...(Ts)>
+    {
+    };
+
+    template <std::size_t I, typename... Ts>
+    struct tuple_element<I, hpx::padded_tuple<Ts...>>
+    {
+        using type =
+            typename hpx::tuple_element<I, hpx::padded_tuple<Ts...>>::type;
+    };
+}    // namespace std
@@ -0,0 +1,121 @@
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks atomic_tuple with each of its storage variants (a single word, a
+// double-width CAS and the seqlock), used from several threads.
+
+#include "atomic_tuple.hpp"
+#include "try_tuple.hpp"
+
+#include "test.hpp"
+
+#include <atomic>
+#include <cstddef>    // for size_t
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+// a version counter next to a pointer, the case a double-width CAS is for
+using versioned_pointer = hpx::atomic_tuple<std::uint64_t, void*>;
+
+static_assert(hpx::atomic_tuple<std::uint32_t, std::uint32_t>::
+                  is_always_lock_free,
+    "tuples of a single word are lock-free");
+#if defined(HPX_TUPLE_HAVE_DOUBLE_WIDTH_CAS)
+static_assert(versioned_pointer::is_always_lock_free &&
+        hpx::atomic_tuple<std::uint64_t, std::uint64_t>::is_always_lock_free,
+    "tuples of two words are lock-free if the build enables the double-width "
+    "CAS");
+#endif
+static_assert(
+    !hpx::atomic_tuple<std::uint64_t, std::uint64_t, char>::is_always_lock_free,
+    "larger tuples use the seqlock");
+
+namespace {
+
+    constexpr std::size_t num_threads = 4;
+
+    // Each thread increments the first two elements of the tuple together
+    // using compare_exchange, readers must never observe them differ.
+    template <typename... Ts>
+    void test_concurrent_increments()
+    {
+        using tuple_type = hpx::tuple<Ts...>;
+        constexpr std::size_t num_increments = 20000;
+
+        hpx::atomic_tuple<Ts...> a(tuple_type{});
+        std::atomic<bool> torn(false);
+
+        std::vector<std::thread> threads;
+        for (std::size_t k = 0; k != num_threads; ++k)
+        {
+            threads.emplace_back([&] {
+                for (std::size_t n = 0; n != num_increments; ++n)
+                {
+                    tuple_type expected = a.load();
+                    tuple_type desired;
+                    do
+                    {
+                        desired = expected;
+                        hpx::get<0>(desired) += 1;
+                        hpx::get<1>(desired) += 1;
+                    } while (!a.compare_exchange_weak(expected, desired));
+
+                    tuple_type const seen = a.load();
+                    if (hpx::get<0>(seen) != hpx::get<1>(seen))
+                        torn = true;
+                }
+            });
+        }
+        for (auto& t : threads)
+            t.join();
+
+        tuple_type const result = a.load();
+        HPX_TEST(!torn);
+        HPX_TEST_EQ(std::size_t(hpx::get<0>(result)),
+            num_threads * num_increments);
+        HPX_TEST_EQ(std::size_t(hpx::get<1>(result)),
+            num_threads * num_increments);
+
+        tuple_type const previous = a.exchange(tuple_type{});
+        HPX_TEST((previous == result));
+        HPX_TEST((a.load() == tuple_type{}));
+    }
+
+    void test_versioned_pointer()
+    {
+        int values[2] = {1, 2};
+        using value_type = versioned_pointer::value_type;
+
+        versioned_pointer p(value_type(0, &values[0]));
+#if defined(HPX_TUPLE_HAVE_DOUBLE_WIDTH_CAS)
+        HPX_TEST(p.is_lock_free());
+#endif
+
+        // a stale version fails even though the pointer matches
+        value_type expected(1, &values[0]);
+        HPX_TEST(!p.compare_exchange_strong(
+            expected, value_type(2, &values[1])));
+        HPX_TEST((expected == value_type(0, &values[0])));
+
+        HPX_TEST(p.compare_exchange_strong(
+            expected, value_type(1, &values[1])));
+        HPX_TEST((p.load() == value_type(1, &values[1])));
+
+        p.store(value_type(2, &values[0]));
+        HPX_TEST((p.exchange(value_type(3, nullptr)) ==
+            value_type(2, &values[0])));
+        HPX_TEST((p.load() == value_type(3, nullptr)));
+    }
+}    // namespace
+
+int main()
+{
+    test_concurrent_increments<std::uint32_t, std::uint32_t>();
+    test_concurrent_increments<std::uint64_t, std::uint64_t>();
+    test_concurrent_increments<std::uint64_t, std::uint64_t, char>();
+    test_versioned_pointer();
+
+    return hpx::test::report_errors();
+}
@@ -0,0 +1,64 @@
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// The generic algorithms call hpx::get<I> qualified, they have to work for
+// bit tuples even if they are defined before bit_tuple.hpp is included.
+#include "tuple_algorithm.hpp"
+#include "tuple_hash.hpp"
+
+#include "bit_tuple.hpp"
+#include "test.hpp"
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+using record = hpx::bit_tuple<bool, hpx::bit_field<std::uint8_t, 5>, bool>;
+
+int main()
+{
+    static_assert(
+        std::is_same<decltype(hpx::get<1>(std::declval<record&>())),
+            record::reference<1>>::value,
+        "");
+    static_assert(
+        std::is_same<decltype(hpx::get<1>(std::declval<record const&>())),
+            std::uint8_t>::value,
+        "");
+    static_assert(std::is_same<decltype(hpx::get<1>(std::declval<record>())),
+                      std::uint8_t>::value,
+        "");
+    static_assert(
+        std::is_same<decltype(hpx::get<1>(std::declval<record const>())),
+            std::uint8_t>::value,
+        "");
+
+    {
+        record r(true, 17, false);
+        hpx::get<1>(r) = 9;
+        hpx::get<2>(r) = true;
+        HPX_TEST_EQ(hpx::get<0>(r), true);
+        HPX_TEST_EQ(hpx::get<1>(r), std::uint8_t(9));
+        HPX_TEST_EQ(hpx::get<2>(std::move(r)), true);
+    }
+
+    {
+        record const a(true, 17, false);
+        record const b(true, 17, false);
+        record const c(true, 18, false);
+        hpx::tuple_hash hash;
+        HPX_TEST_EQ(hash(a), hash(b));
+        HPX_TEST(hash(a) != hash(c));
+    }
+
+    {
+        record const r(false, 0, true);
+        HPX_TEST(hpx::tuple_any(r, [](auto v) { return v != 0; }));
+        HPX_TEST(!hpx::tuple_all(r, [](auto v) { return v != 0; }));
+        HPX_TEST_EQ(
+            hpx::tuple_find_if(r, [](auto v) { return v != 0; }), 2u);
+    }
+
+    return hpx::test::report_errors();
+}
@@ -0,0 +1,166 @@
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks concurrent_tuple_map, tuple_interner and sharded_tuple_interner,
+// used from several threads, against sequentially computed reference
+// results. atomic_tuple is covered by atomic_tuple_test.
+
+#include "concurrent_tuple_map.hpp"
+#include "try_tuple.hpp"
+#include "tuple_interner.hpp"
+
+#include "test.hpp"
+
+#include <cstddef>    // for size_t
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    constexpr std::size_t num_threads = 4;
+
+    template <typename F>
+    void run_threads(F const& f)
+    {
+        std::vector<std::thread> threads;
+        for (std::size_t k = 0; k != num_threads; ++k)
+            threads.emplace_back([&f, k] { f(k); });
+        for (auto& t : threads)
+            t.join();
+    }
+
+    std::string name_of(std::size_t i)
+    {
+        return "customer-" + std::to_string(1000000 + i);
+    }
+
+    void test_concurrent_tuple_map()
+    {
+        using key_type = hpx::tuple<std::uint32_t, std::string>;
+        constexpr std::size_t num_keys = 20000;
+
+        hpx::concurrent_tuple_map<key_type, std::uint64_t> map(8, 4);
+
+        // every thread inserts its share of the keys, then increments the
+        // values of all keys
+        run_threads([&](std::size_t k) {
+            for (std::size_t i = k; i < num_keys; i += num_threads)
+                map.insert(key_type(std::uint32_t(i), name_of(i)), i);
+        });
+        HPX_TEST_EQ(map.size(), num_keys);
+
+        run_threads([&](std::size_t) {
+            for (std::size_t i = 0; i != num_keys; ++i)
+            {
+                std::string const name = name_of(i);
+                map.visit(hpx::forward_as_tuple(
+                              std::uint32_t(i), std::string_view(name)),
+                    [](std::uint64_t& v) { ++v; });
+            }
+        });
+
+        bool found = true;
+        for (std::size_t i = 0; i != num_keys; ++i)
+        {
+            std::uint64_t value = 0;
+            found = found &&
+                map.find(key_type(std::uint32_t(i), name_of(i)), value) &&
+                value == i + num_threads;
+        }
+        HPX_TEST(found);
+
+        HPX_TEST(!map.contains(key_type(1, name_of(2))));
+        HPX_TEST(!map.insert(key_type(1, name_of(1)), 0));
+        HPX_TEST(!map.insert_or_assign(key_type(1, name_of(1)), 42));
+
+        std::uint64_t value = 0;
+        HPX_TEST(map.find(key_type(1, name_of(1)), value));
+        HPX_TEST_EQ(value, std::uint64_t(42));
+
+        // erase every other key concurrently
+        run_threads([&](std::size_t k) {
+            for (std::size_t i = 2 * k; i < num_keys; i += 2 * num_threads)
+                map.erase(key_type(std::uint32_t(i), name_of(i)));
+        });
+        HPX_TEST_EQ(map.size(), num_keys / 2);
+
+        bool erased = true;
+        for (std::size_t i = 0; i != num_keys; ++i)
+        {
+            erased = erased &&
+                map.contains(key_type(std::uint32_t(i), name_of(i))) ==
+                    (i % 2 == 1);
+        }
+        HPX_TEST(erased);
+    }
+
+    void test_tuple_interner()
+    {
+        using value_type = hpx::tuple<int, std::string>;
+
+        hpx::tuple_interner<int, std::string> interner;
+        std::map<value_type, hpx::interned_tuple<int, std::string>> handles;
+        for (int i = 0; i != 10000; ++i)
+        {
+            value_type const v(i % 1000, name_of(std::size_t(i % 7)));
+            auto const h = interner.intern(v);
+            HPX_TEST((*h == v));
+
+            auto const it = handles.emplace(v, h).first;
+            HPX_TEST((it->second == h));
+        }
+        HPX_TEST_EQ(interner.size(), handles.size());
+
+        // lookups through views of the elements find the same handles
+        std::string const name = name_of(3);
+        HPX_TEST((interner.find(hpx::forward_as_tuple(
+                      3, std::string_view(name))) ==
+            handles[value_type(3, name)]));
+        HPX_TEST(!interner.find(value_type(-1, name)));
+    }
+
+    void test_sharded_tuple_interner()
+    {
+        using value_type = hpx::tuple<int, std::string>;
+        using handle = hpx::interned_tuple<int, std::string>;
+        constexpr int num_values = 5000;
+
+        hpx::sharded_tuple_interner<int, std::string> interner(8);
+
+        // all threads intern the same values, in different orders
+        std::vector<std::vector<handle>> handles(
+            num_threads, std::vector<handle>(num_values));
+        run_threads([&](std::size_t k) {
+            for (int n = 0; n != num_values; ++n)
+            {
+                int const i = k % 2 == 0 ? n : num_values - 1 - n;
+                handles[k][i] =
+                    interner.intern(value_type(i, name_of(std::size_t(i))));
+            }
+        });
+        HPX_TEST_EQ(interner.size(), std::size_t(num_values));
+
+        bool same = true;
+        for (int i = 0; i != num_values; ++i)
+        {
+            same = same && *handles[0][i] == value_type(i, name_of(i));
+            for (std::size_t k = 1; k != num_threads; ++k)
+                same = same && handles[k][i] == handles[0][i];
+        }
+        HPX_TEST(same);
+    }
+}    // namespace
+
+int main()
+{
+    test_concurrent_tuple_map();
+    test_tuple_interner();
+    test_sharded_tuple_interner();
+
+    return hpx::test::report_errors();
+}
@@ -0,0 +1,195 @@
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks invoke_fused, deferred_call and unique_function, in particular that
+// unique_function stores small deferred calls inline and larger ones on the
+// heap, and that both are moved and destroyed correctly.
+
+#include "deferred_call.hpp"
+#include "invoke_fused.hpp"
+#include "try_tuple.hpp"
+#include "unique_function.hpp"
+
+#include "test.hpp"
+
+#include <array>
+#include <cstddef>    // for size_t
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace {
+
+    // counts the live instances, to check that every stored callable is
+    // destroyed exactly once
+    struct counted
+    {
+        static int instances;
+
+        counted() noexcept
+        {
+            ++instances;
+        }
+        counted(counted const&) noexcept
+        {
+            ++instances;
+        }
+        counted(counted&&) noexcept
+        {
+            ++instances;
+        }
+        ~counted()
+        {
+            --instances;
+        }
+
+        std::size_t operator()(std::size_t n) const noexcept
+        {
+            return n;
+        }
+    };
+
+    int counted::instances = 0;
+
+    std::size_t sum(std::size_t a, std::string const& s, std::size_t b)
+    {
+        return a + s.size() + b;
+    }
+
+    void test_invoke_fused()
+    {
+        hpx::tuple<std::size_t, std::string, std::size_t> t(1, "abc", 2);
+        HPX_TEST_EQ(hpx::invoke_fused(&sum, t), std::size_t(6));
+
+        // the elements of an lvalue tuple are passed as lvalues
+        hpx::invoke_fused([](std::size_t& a, std::string&, std::size_t& b) {
+            std::swap(a, b);
+        }, t);
+        HPX_TEST_EQ(hpx::get<0>(t), std::size_t(2));
+        HPX_TEST_EQ(hpx::get<2>(t), std::size_t(1));
+
+        // the elements of an rvalue tuple are passed as rvalues
+        hpx::tuple<std::unique_ptr<int>> p(std::make_unique<int>(42));
+        std::unique_ptr<int> const moved = hpx::invoke_fused(
+            [](std::unique_ptr<int>&& q) { return std::move(q); },
+            std::move(p));
+        HPX_TEST(moved != nullptr && *moved == 42);
+        HPX_TEST(hpx::get<0>(p) == nullptr);
+    }
+
+    void test_deferred_call()
+    {
+        std::string const s = "abcd";
+        auto d = hpx::deferred_call(&sum, 1, s, 2);
+
+        // copying a non-const lvalue uses the copy constructor
+        auto copy(d);
+        auto const& cd = d;
+        auto const_copy(cd);
+        HPX_TEST_EQ(copy(), std::size_t(7));
+        HPX_TEST_EQ(const_copy(), std::size_t(7));
+
+        auto moved(std::move(d));
+        HPX_TEST_EQ(moved(), std::size_t(7));
+
+        // the arguments are bound by value
+        HPX_TEST_EQ(s, std::string("abcd"));
+
+        // invoking moves the bound arguments into the call, so a second call
+        // sees them moved from
+        auto once = hpx::deferred_call(
+            [](std::unique_ptr<int> q) { return q != nullptr; },
+            std::make_unique<int>(1));
+        HPX_TEST(once());
+        HPX_TEST(!once());
+    }
+
+    void test_unique_function_inline()
+    {
+        using function = hpx::unique_function<std::size_t()>;
+
+        {
+            auto d = hpx::deferred_call(counted(), std::size_t(3));
+            static_assert(function::is_inline<decltype(d)>(),
+                "a small deferred call is stored inline");
+
+            // a unique_function can be constructed from a non-const lvalue
+            // deferred call, which copies it
+            function f(d);
+            HPX_TEST(bool(f));
+            HPX_TEST_EQ(f(), std::size_t(3));
+
+            function g(std::move(f));
+            HPX_TEST(!f);
+            HPX_TEST_EQ(g(), std::size_t(3));
+
+            f = std::move(g);
+            HPX_TEST(!g);
+            HPX_TEST_EQ(f(), std::size_t(3));
+
+            bool thrown = false;
+            try
+            {
+                g();
+            }
+            catch (std::bad_function_call const&)
+            {
+                thrown = true;
+            }
+            HPX_TEST(thrown);
+        }
+        HPX_TEST_EQ(counted::instances, 0);
+    }
+
+    void test_unique_function_heap()
+    {
+        using function = hpx::unique_function<std::size_t()>;
+
+        {
+            std::array<char, 64> large{};
+            large[10] = 1;
+            auto d = hpx::deferred_call(
+                [](counted const& c, std::array<char, 64> const& a) {
+                    return c(std::size_t(a[10]));
+                },
+                counted(), large);
+            static_assert(!function::is_inline<decltype(d)>(),
+                "a large deferred call is allocated on the heap");
+
+            function f(std::move(d));
+            HPX_TEST_EQ(f(), std::size_t(1));
+
+            function g(std::move(f));
+            HPX_TEST(!f);
+            HPX_TEST_EQ(g(), std::size_t(1));
+
+            g.reset();
+            HPX_TEST(!g);
+        }
+        HPX_TEST_EQ(counted::instances, 0);
+    }
+
+    void test_unique_function_arguments()
+    {
+        hpx::unique_function<std::size_t(std::size_t)> f{counted()};
+        HPX_TEST_EQ(f(5), std::size_t(5));
+
+        hpx::unique_function<std::size_t(std::unique_ptr<int>)> g(
+            [](std::unique_ptr<int> p) { return std::size_t(*p); });
+        HPX_TEST_EQ(g(std::make_unique<int>(8)), std::size_t(8));
+    }
+}    // namespace
+
+int main()
+{
+    test_invoke_fused();
+    test_deferred_call();
+    test_unique_function_inline();
+    test_unique_function_heap();
+    test_unique_function_arguments();
+    HPX_TEST_EQ(counted::instances, 0);
+
+    return hpx::test::report_errors();
+}
@@ -0,0 +1,303 @@
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks the algorithms on structures of arrays (group_by, sort_by_columns,
+// transpose_to_soa/_aos, for_each_tuple, for_each_zipped and tuple_io)
+// against straightforward reference implementations. The parallel versions
+// have to produce the same results as the sequential ones.
+
+#include "for_each_tuple.hpp"
+#include "group_by.hpp"
+#include "try_tuple.hpp"
+#include "tuple_io.hpp"
+#include "tuple_sort.hpp"
+#include "tuple_transpose.hpp"
+
+#include "test.hpp"
+
+#include <algorithm>
+#include <cstddef>    // for size_t
+#include <cstdint>
+#include <map>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace {
+
+    std::uint64_t xorshift(std::uint64_t& state) noexcept
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+
+    // enough rows for the parallel versions to actually use several threads
+    constexpr std::size_t num_rows = 100000;
+
+    struct columns
+    {
+        std::vector<int> region;
+        std::vector<int> product;
+        std::vector<long> amount;
+    };
+
+    columns make_columns()
+    {
+        columns c;
+        std::uint64_t state = 0x2545f4914f6cdd1dull;
+        for (std::size_t i = 0; i != num_rows; ++i)
+        {
+            c.region.push_back(int(xorshift(state) % 7));
+            c.product.push_back(int(xorshift(state) % 50));
+            c.amount.push_back(long(xorshift(state) % 1000) - 500);
+        }
+        return c;
+    }
+
+    void test_group_by()
+    {
+        columns const c = make_columns();
+        auto const soa = hpx::tie(c.region, c.product, c.amount);
+
+        struct totals
+        {
+            long sum = 0;
+            long min = 0;
+            long max = 0;
+            std::size_t count = 0;
+        };
+        std::map<std::pair<int, int>, totals> reference;
+        std::vector<std::pair<int, int>> first_seen;
+        for (std::size_t i = 0; i != num_rows; ++i)
+        {
+            auto const key = std::make_pair(c.region[i], c.product[i]);
+            auto it = reference.find(key);
+            if (it == reference.end())
+            {
+                first_seen.push_back(key);
+                reference[key] = totals{c.amount[i], c.amount[i],
+                    c.amount[i], 1};
+                continue;
+            }
+            it->second.sum += c.amount[i];
+            it->second.min = (std::min)(it->second.min, c.amount[i]);
+            it->second.max = (std::max)(it->second.max, c.amount[i]);
+            ++it->second.count;
+        }
+
+        auto const seq = hpx::group_by<0, 1>(hpx::execution::seq, soa,
+            hpx::aggregate::sum<2>{}, hpx::aggregate::min<2>{},
+            hpx::aggregate::max<2>{}, hpx::aggregate::count{});
+
+        // the groups appear in the order of their first row
+        auto const& regions = hpx::get<0>(seq);
+        auto const& products = hpx::get<1>(seq);
+        HPX_TEST_EQ(regions.size(), first_seen.size());
+        for (std::size_t g = 0; g != regions.size(); ++g)
+        {
+            auto const key = std::make_pair(regions[g], products[g]);
+            HPX_TEST((key == first_seen[g]));
+
+            totals const& expected = reference[key];
+            HPX_TEST_EQ(hpx::get<2>(seq)[g], expected.sum);
+            HPX_TEST_EQ(hpx::get<3>(seq)[g], expected.min);
+            HPX_TEST_EQ(hpx::get<4>(seq)[g], expected.max);
+            HPX_TEST_EQ(std::size_t(hpx::get<5>(seq)[g]), expected.count);
+        }
+
+        for (std::size_t num_threads : {1, 2, 3, 4})
+        {
+            auto const par = hpx::group_by<0, 1>(
+                hpx::execution::par.with(num_threads), soa,
+                hpx::aggregate::sum<2>{}, hpx::aggregate::min<2>{},
+                hpx::aggregate::max<2>{}, hpx::aggregate::count{});
+            HPX_TEST((par == seq));
+        }
+    }
+
+    void test_sort_by_columns()
+    {
+        columns const c = make_columns();
+
+        // rows with equal keys keep their relative order
+        std::vector<std::size_t> reference(num_rows);
+        std::iota(reference.begin(), reference.end(), std::size_t(0));
+        std::stable_sort(reference.begin(), reference.end(),
+            [&](std::size_t lhs, std::size_t rhs) {
+                return std::make_pair(c.product[lhs], c.region[lhs]) <
+                    std::make_pair(c.product[rhs], c.region[rhs]);
+            });
+
+        columns seq = c;
+        hpx::sort_by_columns<1, 0>(
+            hpx::tie(seq.region, seq.product, seq.amount));
+        bool sorted = true;
+        for (std::size_t i = 0; i != num_rows; ++i)
+        {
+            std::size_t const r = reference[i];
+            sorted = sorted && seq.region[i] == c.region[r] &&
+                seq.product[i] == c.product[r] && seq.amount[i] == c.amount[r];
+        }
+        HPX_TEST(sorted);
+
+        for (std::size_t num_threads : {2, 3, 4})
+        {
+            columns par = c;
+            hpx::sort_by_columns<1, 0>(
+                hpx::tie(par.region, par.product, par.amount), num_threads);
+            HPX_TEST((par.region == seq.region));
+            HPX_TEST((par.product == seq.product));
+            HPX_TEST((par.amount == seq.amount));
+        }
+    }
+
+    void test_transpose()
+    {
+        using row = hpx::tuple<int, double, char>;
+
+        std::vector<row> rows;
+        for (std::size_t i = 0; i != 1000; ++i)
+            rows.emplace_back(int(i), 0.5 * double(i), char('a' + i % 26));
+
+        for (std::size_t num_threads : {1, 3})
+        {
+            std::vector<int> ints(rows.size());
+            std::vector<double> doubles(rows.size());
+            std::vector<char> chars(rows.size());
+            hpx::transpose_to_soa(rows.begin(), rows.end(),
+                hpx::tuple<int*, double*, char*>(
+                    ints.data(), doubles.data(), chars.data()),
+                num_threads);
+
+            bool transposed = true;
+            for (std::size_t i = 0; i != rows.size(); ++i)
+            {
+                transposed = transposed && ints[i] == hpx::get<0>(rows[i]) &&
+                    doubles[i] == hpx::get<1>(rows[i]) &&
+                    chars[i] == hpx::get<2>(rows[i]);
+            }
+            HPX_TEST(transposed);
+
+            std::vector<row> back(rows.size());
+            hpx::transpose_to_aos(
+                hpx::tuple<int const*, double const*, char const*>(
+                    ints.data(), doubles.data(), chars.data()),
+                rows.size(), back.begin(), num_threads);
+            HPX_TEST((back == rows));
+        }
+    }
+
+    void test_for_each()
+    {
+        std::vector<hpx::tuple<int, long>> rows;
+        for (int i = 0; i != 10000; ++i)
+            rows.emplace_back(i, 0L);
+
+        auto square = [](int i, long& out) { out = long(i) * i; };
+        hpx::for_each_tuple(
+            hpx::execution::seq, rows.begin(), rows.end(), square);
+        std::vector<hpx::tuple<int, long>> par = rows;
+        for (auto& r : par)
+            hpx::get<1>(r) = 0;
+        hpx::for_each_tuple(
+            hpx::execution::par.with(4), par.begin(), par.end(), square);
+
+        bool squared = true;
+        for (int i = 0; i != 10000; ++i)
+            squared = squared && hpx::get<1>(rows[i]) == long(i) * i;
+        HPX_TEST(squared);
+        HPX_TEST((par == rows));
+
+        std::vector<int> a(10000), b(10000), sum(10000);
+        std::iota(a.begin(), a.end(), 0);
+        std::iota(b.begin(), b.end(), 5);
+        hpx::for_each_zipped(hpx::execution::par.with(3),
+            hpx::tuple<int const*, int const*, int*>(
+                a.data(), b.data(), sum.data()),
+            sum.size(), [](int x, int y, int& s) { s = x + y; });
+
+        bool added = true;
+        for (std::size_t i = 0; i != sum.size(); ++i)
+            added = added && sum[i] == int(2 * i + 5);
+        HPX_TEST(added);
+    }
+
+    void test_tuple_io()
+    {
+        using record = hpx::tuple<int, double, bool, std::string>;
+
+        std::vector<record> records;
+        for (int i = 0; i != 500; ++i)
+        {
+            records.emplace_back(i - 250, 0.25 * i, i % 3 == 0,
+                "name-" + std::to_string(i));
+        }
+
+        std::ostringstream out;
+        {
+            hpx::tuple_record_writer writer(out, ';', 64);
+            for (record const& r : records)
+                writer.write(r);
+            writer.flush();
+        }
+        std::string const text = out.str();
+
+        // the format is the one of the reference formatting
+        std::string expected;
+        for (record const& r : records)
+        {
+            std::ostringstream line;
+            line << hpx::get<0>(r) << ';' << hpx::get<1>(r) << ';'
+                 << (hpx::get<2>(r) ? 1 : 0) << ';' << hpx::get<3>(r) << '\n';
+            expected += line.str();
+        }
+        HPX_TEST_EQ(text, expected);
+
+        {
+            std::istringstream in(text);
+            hpx::tuple_record_reader<record> reader(in, ';', 100);
+            std::vector<record> read;
+            record r;
+            while (reader.next(r))
+                read.push_back(r);
+            HPX_TEST((read == records));
+            HPX_TEST_EQ(reader.line_number(), records.size());
+        }
+
+        for (std::size_t num_threads : {1, 4})
+        {
+            std::vector<int> seen(records.size(), 0);
+            hpx::for_each_tuple_record<
+                hpx::tuple<int, double, bool, std::string_view>>(
+                text,
+                [&](auto const& r) {
+                    std::size_t const i = std::size_t(hpx::get<0>(r) + 250);
+                    if (hpx::get<3>(r) == hpx::get<3>(records[i]))
+                        ++seen[i];
+                },
+                num_threads, ';');
+            HPX_TEST((seen == std::vector<int>(records.size(), 1)));
+        }
+
+        record r;
+        HPX_TEST(!hpx::parse_tuple_record("1;2.5;1", r, ';'));
+        HPX_TEST(!hpx::parse_tuple_record("x;2.5;1;name", r, ';'));
+    }
+}    // namespace
+
+int main()
+{
+    test_group_by();
+    test_sort_by_columns();
+    test_transpose();
+    test_for_each();
+    test_tuple_io();
+
+    return hpx::test::report_errors();
+}
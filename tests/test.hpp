@@ -0,0 +1,59 @@
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Minimal checks for the tests, which keep running after a failure and
+// report the number of failures from main. They stay active in release
+// builds, unlike assert.
+
+#pragma once
+
+#include <cstddef>    // for size_t
+#include <iostream>
+
+namespace hpx { namespace test {
+
+    inline std::size_t& failures() noexcept
+    {
+        static std::size_t count = 0;
+        return count;
+    }
+
+    inline void check(bool ok, char const* expr, char const* file, int line)
+    {
+        if (!ok)
+        {
+            ++failures();
+            std::cerr << file << "(" << line << "): test '" << expr
+                      << "' failed\n";
+        }
+    }
+
+    template <typename T, typename U>
+    void check_equal(T const& t, U const& u, char const* lhs, char const* rhs,
+        char const* file, int line)
+    {
+        if (!(t == u))
+        {
+            ++failures();
+            std::cerr << file << "(" << line << "): test '" << lhs
+                      << " == " << rhs << "' failed\n";
+        }
+    }
+
+    // the exit code of the test
+    inline int report_errors()
+    {
+        if (failures() != 0)
+        {
+            std::cerr << failures() << " test(s) failed\n";
+            return 1;
+        }
+        return 0;
+    }
+}}    // namespace hpx::test
+
+#define HPX_TEST(expr) ::hpx::test::check(bool(expr), #expr, __FILE__, __LINE__)
+
+#define HPX_TEST_EQ(lhs, rhs)                                                  \
+    ::hpx::test::check_equal(lhs, rhs, #lhs, #rhs, __FILE__, __LINE__)
@@ -0,0 +1,95 @@
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks the element-wise tuple arithmetic against the same computation
+// written out element by element.
+
+#include "try_tuple.hpp"
+#include "tuple_arithmetic.hpp"
+
+#include "test.hpp"
+
+#include <array>
+#include <cstddef>    // for size_t
+#include <utility>
+
+using vec3 = std::array<double, 3>;
+using vec4 = std::array<double, 4>;
+using state = hpx::tuple<vec3, double, std::array<int, 2>>;
+
+// the extent of array operands has to match the destination element, only
+// scalars are broadcast
+using mismatched_expr =
+    decltype(std::declval<hpx::tuple<vec3> const&>() +
+        std::declval<hpx::tuple<vec4> const&>());
+static_assert(!mismatched_expr::fits<0, 3>() &&
+        !mismatched_expr::fits<0, 4>(),
+    "arrays of different extent must not be combined");
+
+using broadcast_expr =
+    decltype(std::declval<hpx::tuple<vec3> const&>() * 2.0);
+static_assert(broadcast_expr::fits<0, 3>(), "scalars are broadcast");
+
+int main()
+{
+    state const a(vec3{1.0, 2.0, 3.0}, 4.0, std::array<int, 2>{5, 6});
+    state const b(vec3{0.5, -1.0, 2.5}, -2.0, std::array<int, 2>{7, -8});
+
+    // a + b * 2
+    {
+        state r;
+        hpx::tuple_assign(r, a + b * 2);
+
+        bool equal = true;
+        for (std::size_t k = 0; k != 3; ++k)
+        {
+            equal = equal &&
+                hpx::get<0>(r)[k] ==
+                    hpx::get<0>(a)[k] + hpx::get<0>(b)[k] * 2;
+        }
+        HPX_TEST(equal);
+        HPX_TEST_EQ(hpx::get<1>(r), 4.0 + -2.0 * 2);
+        HPX_TEST_EQ(hpx::get<2>(r)[0], 5 + 7 * 2);
+        HPX_TEST_EQ(hpx::get<2>(r)[1], 6 + -8 * 2);
+    }
+
+    // y = 3 * x + y
+    {
+        state y = b;
+        hpx::tuple_axpy(3, a, y);
+
+        bool equal = true;
+        for (std::size_t k = 0; k != 3; ++k)
+        {
+            equal = equal &&
+                hpx::get<0>(y)[k] ==
+                    3 * hpx::get<0>(a)[k] + hpx::get<0>(b)[k];
+        }
+        HPX_TEST(equal);
+        HPX_TEST_EQ(hpx::get<1>(y), 3 * 4.0 + -2.0);
+        HPX_TEST_EQ(hpx::get<2>(y)[0], 3 * 5 + 7);
+        HPX_TEST_EQ(hpx::get<2>(y)[1], 3 * 6 + -8);
+    }
+
+    // a chained expression reading the destination itself
+    {
+        state r = a;
+        hpx::tuple_assign(r, (r + b) * (a - b) / 2 - r);
+
+        bool equal = true;
+        for (std::size_t k = 0; k != 3; ++k)
+        {
+            double const ak = hpx::get<0>(a)[k];
+            double const bk = hpx::get<0>(b)[k];
+            equal = equal &&
+                hpx::get<0>(r)[k] == (ak + bk) * (ak - bk) / 2 - ak;
+        }
+        HPX_TEST(equal);
+        HPX_TEST_EQ(hpx::get<1>(r), (4.0 + -2.0) * (4.0 - -2.0) / 2 - 4.0);
+        HPX_TEST_EQ(hpx::get<2>(r)[0], (5 + 7) * (5 - 7) / 2 - 5);
+        HPX_TEST_EQ(hpx::get<2>(r)[1], (6 + -8) * (6 - -8) / 2 - 6);
+    }
+
+    return hpx::test::report_errors();
+}
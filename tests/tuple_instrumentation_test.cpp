@@ -0,0 +1,125 @@
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks that the instrumentation enabled by HPX_TUPLE_HAVE_INSTRUMENTATION
+// counts the tuple operations per call site and tuple type, in particular
+// that the forwarding constructor and the creation functions are attributed
+// to the lines calling them.
+
+#if !defined(HPX_TUPLE_HAVE_INSTRUMENTATION)
+#error "this test has to be compiled with HPX_TUPLE_HAVE_INSTRUMENTATION"
+#endif
+
+#include "try_tuple.hpp"
+
+#include "test.hpp"
+
+#include <cstddef>    // for size_t
+#include <mutex>
+#include <string>
+#include <typeinfo>
+#include <utility>
+
+namespace {
+
+    using hpx::detail::tuple_event;
+
+    // the number of events counted at a line of this file for the given
+    // tuple type
+    template <typename Tuple>
+    std::size_t count(tuple_event event, unsigned line)
+    {
+        hpx::detail::tuple_event_local().flush();
+
+        hpx::detail::tuple_event_global_registry& global =
+            hpx::detail::tuple_event_global();
+        std::lock_guard<std::mutex> l(global.mtx);
+        auto const it = global.table.find(hpx::detail::tuple_event_key(
+            std::string(__FILE__) + ':' + std::to_string(line),
+            typeid(Tuple).name()));
+        if (it == global.table.end())
+            return 0;
+        return it->second[static_cast<std::size_t>(event)];
+    }
+
+    using pair = hpx::tuple<int, std::string>;
+
+    void test_constructors()
+    {
+        std::string const name = "one";
+
+        pair p(1, name);
+        HPX_TEST_EQ(count<pair>(tuple_event::construct, __LINE__ - 1), 1u);
+
+        // the forwarding constructor
+        pair q(2, "two");
+        HPX_TEST_EQ(count<pair>(tuple_event::construct, __LINE__ - 1), 1u);
+
+        pair c(p);
+        HPX_TEST_EQ(count<pair>(tuple_event::copy, __LINE__ - 1), 1u);
+
+        pair m(std::move(q));
+        HPX_TEST_EQ(count<pair>(tuple_event::move, __LINE__ - 1), 1u);
+
+        hpx::tuple<long, std::string> l(p);
+        unsigned const convert_line = __LINE__ - 1;
+        HPX_TEST_EQ((count<hpx::tuple<long, std::string>>(
+                        tuple_event::convert, convert_line)),
+            1u);
+
+        for (int i = 0; i != 3; ++i)
+            pair(i, "loop");
+        HPX_TEST_EQ(count<pair>(tuple_event::construct, __LINE__ - 1), 3u);
+
+        // more elements than the overloads receiving the call site take
+        using quintuple = hpx::tuple<int, int, int, int, std::string>;
+        quintuple five(1, 2, 3, 4, "five");
+        HPX_TEST_EQ(count<quintuple>(tuple_event::construct, __LINE__ - 1), 0u);
+
+        // constant evaluation is not counted
+        constexpr hpx::tuple<int, int> k(1, 2);
+        unsigned const constexpr_line = __LINE__ - 1;
+        static_assert(hpx::get<1>(k) == 2, "");
+        HPX_TEST_EQ((count<hpx::tuple<int, int>>(
+                        tuple_event::construct, constexpr_line)),
+            0u);
+    }
+
+    void test_creation_functions()
+    {
+        using refs = hpx::tuple<int&, std::string&>;
+
+        int i = 0;
+        std::string s;
+        pair const p(1, "one");
+
+        hpx::tie(i, s) = p;
+        unsigned const tie_line = __LINE__ - 1;
+        HPX_TEST_EQ(count<refs>(tuple_event::tie, tie_line), 1u);
+        HPX_TEST_EQ(count<refs>(tuple_event::construct, tie_line), 1u);
+        HPX_TEST(i == 1 && s == "one");
+
+        auto const f = hpx::forward_as_tuple(i, s);
+        unsigned const forward_line = __LINE__ - 1;
+        HPX_TEST_EQ(
+            count<refs>(tuple_event::forward_as_tuple, forward_line), 1u);
+        HPX_TEST_EQ(count<refs>(tuple_event::construct, forward_line), 1u);
+
+        using result = hpx::tuple<int, std::string, int&, std::string&>;
+        auto const cat = hpx::tuple_cat(p, f);
+        HPX_TEST_EQ(count<result>(tuple_event::tuple_cat, __LINE__ - 1), 1u);
+        HPX_TEST((cat == result(1, "one", i, s)));
+
+        HPX_TEST_EQ(hpx::get<1>(pair(p)), std::string("one"));
+        HPX_TEST_EQ(count<pair>(tuple_event::rvalue_get, __LINE__ - 1), 1u);
+    }
+}    // namespace
+
+int main()
+{
+    test_constructors();
+    test_creation_functions();
+
+    return hpx::test::report_errors();
+}
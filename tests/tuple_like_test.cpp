@@ -0,0 +1,170 @@
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks that types implementing the std tuple protocol, std::tuple and user
+// records specializing std::tuple_size/std::tuple_element, are tuple-like for
+// hpx::get, hpx::tuple_cat and the relational operators.
+
+#include "try_tuple.hpp"
+
+#include "test.hpp"
+
+#include <cstddef>    // for size_t
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace app {
+
+    // a record with a member get<I>()
+    struct point
+    {
+        int x;
+        double y;
+
+        template <std::size_t I>
+        constexpr auto& get() noexcept
+        {
+            if constexpr (I == 0)
+                return x;
+            else
+                return y;
+        }
+
+        template <std::size_t I>
+        constexpr auto const& get() const noexcept
+        {
+            if constexpr (I == 0)
+                return x;
+            else
+                return y;
+        }
+    };
+
+    // a record with get<I>(t) found by argument dependent lookup
+    struct person
+    {
+        int id;
+        std::string name;
+    };
+
+    template <std::size_t I>
+    auto& get(person& p) noexcept
+    {
+        if constexpr (I == 0)
+            return p.id;
+        else
+            return p.name;
+    }
+
+    template <std::size_t I>
+    auto const& get(person const& p) noexcept
+    {
+        if constexpr (I == 0)
+            return p.id;
+        else
+            return p.name;
+    }
+}    // namespace app
+
+namespace std {
+
+    template <>
+    struct tuple_size<app::point> : std::integral_constant<std::size_t, 2>
+    {
+    };
+
+    template <>
+    struct tuple_element<0, app::point>
+    {
+        using type = int;
+    };
+
+    template <>
+    struct tuple_element<1, app::point>
+    {
+        using type = double;
+    };
+
+    template <>
+    struct tuple_size<app::person> : std::integral_constant<std::size_t, 2>
+    {
+    };
+
+    template <>
+    struct tuple_element<0, app::person>
+    {
+        using type = int;
+    };
+
+    template <>
+    struct tuple_element<1, app::person>
+    {
+        using type = std::string;
+    };
+}    // namespace std
+
+template <typename Tuple, std::size_t I, typename Expected>
+constexpr bool get_yields()
+{
+    return std::is_same<decltype(hpx::get<I>(std::declval<Tuple>())),
+        Expected>::value;
+}
+
+static_assert(hpx::tuple_size<std::tuple<int, char>>::value == 2, "");
+static_assert(hpx::tuple_size<app::point const>::value == 2, "");
+static_assert(std::is_same<hpx::tuple_element<1, app::person>::type,
+                  std::string>::value,
+    "");
+
+static_assert(get_yields<std::tuple<int, char>&, 0, int&>(), "");
+static_assert(get_yields<std::tuple<int, char> const&, 0, int const&>(), "");
+static_assert(get_yields<std::tuple<int, char>&&, 0, int&&>(), "");
+static_assert(
+    get_yields<std::tuple<int, char> const&&, 0, int const&&>(), "");
+
+static_assert(get_yields<app::point&, 1, double&>(), "");
+static_assert(get_yields<app::point const&, 1, double const&>(), "");
+static_assert(get_yields<app::point&&, 1, double&&>(), "");
+
+static_assert(get_yields<app::person&, 1, std::string&>(), "");
+static_assert(get_yields<app::person const&, 1, std::string const&>(), "");
+static_assert(get_yields<app::person&&, 1, std::string&&>(), "");
+
+static_assert(std::is_same<decltype(hpx::tuple_cat(
+                               std::declval<std::tuple<int, char>>(),
+                               std::declval<app::person const&>())),
+                  hpx::tuple<int, char, int, std::string>>::value,
+    "");
+
+static_assert(hpx::get<1>(app::point{1, 2.5}) == 2.5, "");
+
+int main()
+{
+    std::tuple<int, std::string> t(1, "one");
+    hpx::get<0>(t) = 2;
+    HPX_TEST_EQ(std::get<0>(t), 2);
+
+    app::person p{3, "three"};
+    hpx::get<1>(p) += "!";
+    HPX_TEST_EQ(p.name, std::string("three!"));
+
+    // the elements of rvalue operands are moved into the result
+    auto const cat =
+        hpx::tuple_cat(std::move(t), app::point{4, 0.5}, std::move(p));
+    HPX_TEST((cat ==
+        hpx::tuple<int, std::string, int, double, int, std::string>(
+            2, "one", 4, 0.5, 3, "three!")));
+    HPX_TEST(std::get<1>(t).empty());
+    HPX_TEST(p.name.empty());
+
+    // an hpx::tuple compares with any tuple-like type of the same size
+    HPX_TEST((hpx::tuple<int, double>(1, 2.5) == app::point{1, 2.5}));
+    HPX_TEST((std::tuple<int, char>(1, 'a') < hpx::tuple<int, char>(1, 'b')));
+    HPX_TEST((hpx::tuple<int, std::string>(3, "three") !=
+        app::person{3, "four"}));
+
+    return hpx::test::report_errors();
+}
@@ -0,0 +1,274 @@
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "test.hpp"
+#include "when_all.hpp"
+
+#include <coroutine>
+#include <cstddef>    // for size_t
+#include <cstdlib>
+#include <exception>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+// counts the allocations made through the global operator new, the
+// replacements are not inlined into their callers to keep GCC from pairing
+// the free below with the new expression
+static std::size_t num_allocations = 0;
+
+__attribute__((noinline)) void* operator new(std::size_t size)
+{
+    ++num_allocations;
+    if (void* p = std::malloc(size != 0 ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+__attribute__((noinline)) void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+__attribute__((noinline)) void operator delete(
+    void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+// A lazily started coroutine yielding a T, resuming its awaiter when done.
+template <typename T>
+class task
+{
+public:
+    struct promise_type
+    {
+        task get_return_object() noexcept
+        {
+            return task(
+                std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_always initial_suspend() noexcept
+        {
+            return {};
+        }
+
+        struct final_awaiter
+        {
+            bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            std::coroutine_handle<> await_suspend(
+                std::coroutine_handle<promise_type> h) noexcept
+            {
+                return h.promise().continuation;
+            }
+
+            void await_resume() const noexcept {}
+        };
+
+        final_awaiter final_suspend() noexcept
+        {
+            return {};
+        }
+
+        void return_value(T value)
+        {
+            result.emplace(std::move(value));
+        }
+
+        void unhandled_exception() noexcept
+        {
+            exception = std::current_exception();
+        }
+
+        std::coroutine_handle<> continuation;
+        std::optional<T> result;
+        std::exception_ptr exception;
+    };
+
+    task(task&& other) noexcept
+      : _handle(std::exchange(other._handle, nullptr))
+    {
+    }
+
+    task& operator=(task&&) = delete;
+
+    ~task()
+    {
+        if (_handle)
+            _handle.destroy();
+    }
+
+    struct awaiter
+    {
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> h)
+        {
+            handle.promise().continuation = h;
+            return handle;
+        }
+
+        T await_resume()
+        {
+            if (handle.promise().exception)
+                std::rethrow_exception(handle.promise().exception);
+            return std::move(*handle.promise().result);
+        }
+
+        std::coroutine_handle<promise_type> handle;
+    };
+
+    awaiter operator co_await() && noexcept
+    {
+        return awaiter{_handle};
+    }
+
+private:
+    explicit task(std::coroutine_handle<promise_type> handle) noexcept
+      : _handle(handle)
+    {
+    }
+
+    std::coroutine_handle<promise_type> _handle;
+};
+
+// completes after being rescheduled hops times
+template <typename T>
+task<T> async_value(hpx::single_thread_executor& ex, T value, int hops = 1)
+{
+    for (int i = 0; i != hops; ++i)
+        co_await ex.schedule();
+    co_return value;
+}
+
+task<int> async_throw(hpx::single_thread_executor& ex)
+{
+    co_await ex.schedule();
+    throw std::runtime_error("async_throw");
+}
+
+// completes synchronously, without suspending
+struct ready_value
+{
+    bool await_ready() const noexcept
+    {
+        return true;
+    }
+
+    void await_suspend(std::coroutine_handle<>) noexcept {}
+
+    int await_resume() const noexcept
+    {
+        return value;
+    }
+
+    int value;
+};
+
+// resumes on the executor, without a coroutine frame of its own
+struct scheduled_value
+{
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    void await_suspend(std::coroutine_handle<> h)
+    {
+        ex->schedule().await_suspend(h);
+    }
+
+    int await_resume() const noexcept
+    {
+        return value;
+    }
+
+    hpx::single_thread_executor* ex;
+    int value;
+};
+
+task<hpx::tuple<int, std::string, double>> mixed(
+    hpx::single_thread_executor& ex)
+{
+    co_return co_await hpx::when_all(async_value(ex, 1, 3),
+        async_value(ex, std::string("two")), ready_value{3});
+}
+
+task<int> nested(hpx::single_thread_executor& ex)
+{
+    auto const result = co_await hpx::when_all(
+        hpx::when_all(async_value(ex, 1), async_value(ex, 2)),
+        async_value(ex, 3, 2));
+    auto const& inner = hpx::get<0>(result);
+    co_return hpx::get<0>(inner) + hpx::get<1>(inner) + hpx::get<1>(result);
+}
+
+int main()
+{
+    hpx::single_thread_executor ex;
+
+    {
+        static_assert(
+            std::is_same<decltype(hpx::sync_wait(ex, mixed(ex))),
+                hpx::tuple<int, std::string, double>>::value);
+
+        auto const result = hpx::sync_wait(ex, mixed(ex));
+        HPX_TEST_EQ(hpx::get<0>(result), 1);
+        HPX_TEST_EQ(hpx::get<1>(result), std::string("two"));
+        HPX_TEST_EQ(hpx::get<2>(result), 3.0);
+    }
+
+    HPX_TEST_EQ(hpx::sync_wait(ex, nested(ex)), 6);
+
+    // everything completes synchronously
+    {
+        auto const result =
+            hpx::sync_wait(ex, hpx::when_all(ready_value{1}, ready_value{2}));
+        HPX_TEST((result == hpx::tuple<int, int>(1, 2)));
+    }
+
+    {
+        auto const result = hpx::sync_wait(ex, hpx::when_all());
+        HPX_TEST(result == hpx::tuple<>());
+    }
+
+    // the first exception is rethrown
+    {
+        bool caught = false;
+        try
+        {
+            hpx::sync_wait(ex,
+                hpx::when_all(async_value(ex, 1), async_throw(ex)));
+        }
+        catch (std::runtime_error const& e)
+        {
+            caught = std::string(e.what()) == "async_throw";
+        }
+        HPX_TEST(caught);
+    }
+
+    // the frames of the coroutines awaiting the arguments live inside the
+    // when_all object, only the frame of sync_wait is allocated
+    {
+        std::size_t const before = num_allocations;
+        auto const result = hpx::sync_wait(ex,
+            hpx::when_all(scheduled_value{&ex, 1}, scheduled_value{&ex, 2},
+                scheduled_value{&ex, 3}, scheduled_value{&ex, 4}));
+        HPX_TEST_EQ(num_allocations - before, std::size_t(1));
+        HPX_TEST((result == hpx::tuple<int, int, int, int>(1, 2, 3, 4)));
+    }
+
+    return hpx::test::report_errors();
+}
@@ -10,10 +10,12 @@
 
 #include "always_void.hpp"
 #include "pack.hpp"
+#include "tuple_instrumentation.hpp"
 
 #include <algorithm>
 #include <array>
 #include <cstddef>    // for size_t
+#include <cstring>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -40,38 +42,61 @@ namespace hpx {
     template <std::size_t I, typename T>
     struct tuple_element;    // undefined
 
+    namespace detail {
+
+        // The result of tuple_element<I, Tuple>::get, the element access of
+        // any tuple-like type, for an Object of type Tuple. This is a
+        // reference to the element for all but the tuple-like types yielding
+        // proxies (or values) instead, like bit_tuple.
+        template <std::size_t I, typename Tuple, typename Object = Tuple&>
+        using tuple_element_get_t = decltype(
+            tuple_element<I, Tuple>::get(std::declval<Object>()));
+
+        // The rvalue overloads of get move out of the element if the access
+        // yields a reference, and forward the result of the access to the
+        // const object otherwise.
+        template <std::size_t I, typename Tuple, typename Element>
+        using tuple_element_rvalue_get_t = typename std::conditional<
+            std::is_lvalue_reference<tuple_element_get_t<I, Tuple>>::value,
+            Element&&, tuple_element_get_t<I, Tuple, Tuple const&>>::type;
+    }    // namespace detail
+
     // Hide implementations of get<> inside an internal namespace to be able to
     // import those into the namespace std below without pulling in all of
-    // hpx::util.
+    // hpx::util. They are available for all types providing
+    // tuple_element<I, T>::get, which allows to use them from generic code
+    // defined before the tuple-like type.
     namespace adl_barrier {
 
         template <std::size_t I, typename Tuple,
             typename Enable = typename util::always_void<
                 typename tuple_element<I, Tuple>::type>::type>
         constexpr __host__ __device__ inline
-            typename tuple_element<I, Tuple>::type&
+            detail::tuple_element_get_t<I, Tuple>
             get(Tuple& t) noexcept;
 
         template <std::size_t I, typename Tuple,
             typename Enable = typename util::always_void<
                 typename tuple_element<I, Tuple>::type>::type>
         constexpr __host__ __device__ inline
-            typename tuple_element<I, Tuple>::type const&
+            detail::tuple_element_get_t<I, Tuple, Tuple const&>
             get(Tuple const& t) noexcept;
 
         template <std::size_t I, typename Tuple,
             typename Enable = typename util::always_void<typename tuple_element<
                 I, typename std::decay<Tuple>::type>::type>::type>
         constexpr __host__ __device__ inline
-            typename tuple_element<I, Tuple>::type&&
-            get(Tuple&& t) noexcept;
+            detail::tuple_element_rvalue_get_t<I, Tuple,
+                typename tuple_element<I, Tuple>::type>
+            get(Tuple&& t HPX_TUPLE_CALL_SITE) noexcept;
 
         template <std::size_t I, typename Tuple,
             typename Enable = typename util::always_void<
                 typename tuple_element<I, Tuple>::type>::type>
         constexpr __host__ __device__ inline
-            typename tuple_element<I, Tuple>::type const&&
-            get(Tuple const&& t) noexcept;
+            detail::tuple_element_rvalue_get_t<I, Tuple,
+                typename tuple_element<I, Tuple>::type const>
+            get(Tuple const&& t HPX_TUPLE_CALL_SITE) noexcept;
     }    // namespace adl_barrier
 
     // we separate the implementation of get for our tuple type so that
@@ -91,12 +116,26 @@ namespace hpx {
         template <std::size_t I, typename... Ts>
         constexpr __host__ __device__ inline
             typename tuple_element<I, tuple<Ts...>>::type&&
-            get(tuple<Ts...>&& t) noexcept;
+            get(tuple<Ts...>&& t HPX_TUPLE_CALL_SITE) noexcept;
 
         template <std::size_t I, typename... Ts>
         constexpr __host__ __device__ inline
             typename tuple_element<I, tuple<Ts...>>::type const&&
-            get(tuple<Ts...> const&& t) noexcept;
+            get(tuple<Ts...> const&& t HPX_TUPLE_CALL_SITE) noexcept;
+
+        template <typename T, typename... Ts>
+        constexpr __host__ __device__ inline T& get(tuple<Ts...>& t) noexcept;
+
+        template <typename T, typename... Ts>
+        constexpr __host__ __device__ inline T const& get(
+            tuple<Ts...> const& t) noexcept;
+
+        template <typename T, typename... Ts>
+        constexpr __host__ __device__ inline T&& get(tuple<Ts...>&& t) noexcept;
+
+        template <typename T, typename... Ts>
+        constexpr __host__ __device__ inline T const&& get(
+            tuple<Ts...> const&& t) noexcept;
     }    // namespace std_adl_barrier
 
     using hpx::adl_barrier::get;
@@ -112,8 +151,10 @@ namespace hpx {
         struct ignore_type
         {
             template <typename T>
-            void operator=(T&& t) const
+            constexpr __host__ __device__ ignore_type const& operator=(
+                T&& /*t*/) const noexcept
             {
+                return *this;
             }
         };
     }    // namespace detail
@@ -143,15 +184,570 @@ namespace hpx {
 
         // tuple& operator=(const tuple& u);
         // Assigns each element of u to the corresponding element of *this.
-        __host__ __device__ tuple& operator=(tuple const& /*other*/) noexcept
+        tuple& operator=(tuple const& /*other*/) = default;
+
+        // tuple& operator=(tuple&& u) noexcept(see below );
+        // For all i, assigns std::forward<Ti>(get<i>(u)) to get<i>(*this).
+        tuple& operator=(tuple&& /*other*/) = default;
+
+        // 20.4.2.3, tuple swap
+
+        // void swap(tuple& rhs) noexcept(see below);
+        // Calls swap for each element in *this and its corresponding element
+        // in rhs.
+        constexpr __host__ __device__ void swap(tuple& /*other*/) noexcept {}
+
+    };
+
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        // Copies, moves and assignments are defaulted, which makes a tuple of
+        // trivially copyable elements trivially copyable itself.
+        template <std::size_t I, typename T,
+            bool IsReference = std::is_reference<T>::value>
+        struct tuple_member
         {
-            return *this;
+        public:    // exposition-only
+            T _value;
+
+        public:
+            // 20.4.2.1, tuple construction
+            constexpr __host__ __device__ tuple_member()
+              : _value()
+            {
+            }
+
+            template <typename U>
+            explicit constexpr __host__ __device__ tuple_member(U&& value)
+              : _value(std::forward<U>(value))
+            {
+            }
+
+            tuple_member(tuple_member const&) = default;
+            tuple_member(tuple_member&&) = default;
+
+            tuple_member& operator=(tuple_member const&) = default;
+            tuple_member& operator=(tuple_member&&) = default;
+
+            constexpr __host__ __device__ T& value() noexcept
+            {
+                return _value;
+            }
+
+            constexpr __host__ __device__ T const& value() const noexcept
+            {
+                return _value;
+            }
+        };
+
+        // Reference members are bound on construction, assigning to them
+        // assigns to the referenced objects.
+        template <std::size_t I, typename T>
+        struct tuple_member<I, T, true>
+        {
+        public:    // exposition-only
+            T _value;
+
+        public:
+            // 20.4.2.1, tuple construction
+            template <typename U>
+            explicit constexpr __host__ __device__ tuple_member(U&& value)
+              : _value(std::forward<U>(value))
+            {
+            }
+
+            tuple_member(tuple_member const&) = default;
+            tuple_member(tuple_member&&) = default;
+
+            using referenced_type = typename std::remove_reference<T>::type;
+
+            constexpr __host__ __device__ tuple_member& operator=(
+                tuple_member const& other) noexcept(std::
+                    is_nothrow_assignable<referenced_type&,
+                        referenced_type&>::value)
+            {
+                _value = other._value;
+                return *this;
+            }
+
+            constexpr __host__ __device__ tuple_member& operator=(
+                tuple_member&& other) noexcept(std::
+                    is_nothrow_assignable<referenced_type&, T>::value)
+            {
+                _value = std::forward<T>(other._value);
+                return *this;
+            }
+
+            constexpr __host__ __device__ T& value() noexcept
+            {
+                return _value;
+            }
+
+            constexpr __host__ __device__ T const& value() const noexcept
+            {
+                return _value;
+            }
+        };
+
+        // The placeholders created by tie(..., ignore, ...) do not store a
+        // reference, they refer to their own (empty) base instead.
+        template <std::size_t I>
+        struct tuple_member<I, ignore_type const&, true> : ignore_type
+        {
+            template <typename U>
+            explicit constexpr __host__ __device__ tuple_member(
+                U&& /*value*/) noexcept
+            {
+            }
+
+            constexpr __host__ __device__ ignore_type const& value()
+                const noexcept
+            {
+                return *this;
+            }
+        };
+
+        template <typename T>
+        struct is_ignore_member : std::false_type
+        {
+        };
+
+        template <>
+        struct is_ignore_member<ignore_type const&> : std::true_type
+        {
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Whether each element of tuple<Ts...> can be constructed from (or
+        // assigned from) the corresponding element of the tuple-like UTuple,
+        // taken with UTuple's value category.
+        template <typename T, typename U>
+        using is_tuple_element_assignable = std::is_assignable<T&, U>;
+
+        template <template <typename, typename> class Trait, typename Is,
+            typename Tuple, typename UTuple, typename Enable = void>
+        struct are_tuples_compatible_impl : std::false_type
+        {
+        };
+
+        template <template <typename, typename> class Trait, std::size_t... Is,
+            typename... Ts, typename UTuple>
+        struct are_tuples_compatible_impl<Trait, util::index_pack<Is...>,
+            tuple<Ts...>, UTuple,
+            typename std::enable_if<tuple_size<typename std::remove_reference<
+                                        UTuple>::type>::value ==
+                sizeof...(Ts)>::type>
+          : std::integral_constant<bool,
+                (Trait<Ts,
+                     decltype(hpx::get<Is>(std::declval<UTuple>()))>::value &&
+                    ...)>
+        {
+        };
+
+        template <typename Tuple, typename UTuple>
+        struct are_tuples_compatible
+          : are_tuples_compatible_impl<std::is_constructible,
+                typename util::make_index_pack<tuple_size<Tuple>::value>::type,
+                Tuple, UTuple>
+        {
+        };
+
+        template <typename Tuple, typename UTuple>
+        struct are_tuples_assignable
+          : are_tuples_compatible_impl<is_tuple_element_assignable,
+                typename util::make_index_pack<tuple_size<Tuple>::value>::type,
+                Tuple, UTuple>
+        {
+        };
+
+        // Whether each element of tuple<Ts...> can be constructed from the
+        // corresponding argument of type Us&&. The builtin avoids
+        // instantiating std::is_constructible for every element, which is
+        // noticeable for the large tuples created by tuple_cat.
+        template <typename Ts, typename Us, typename Enable = void>
+        struct are_elements_constructible : std::false_type
+        {
+        };
+
+        template <typename... Ts, typename... Us>
+        struct are_elements_constructible<util::pack<Ts...>,
+            util::pack<Us...>,
+            typename std::enable_if<sizeof...(Ts) == sizeof...(Us)>::type>
+          : std::integral_constant<bool,
+                (__is_constructible(Ts, Us&&) && ...)>
+        {
+        };
+
+        // A single element tuple constructible from UTuple itself is
+        // initialized from UTuple as a whole rather than from its elements.
+        template <typename Tuple, typename UTuple>
+        struct is_tuple_converting_constructible
+          : std::integral_constant<bool,
+                !std::is_same<Tuple,
+                    typename std::decay<UTuple>::type>::value &&
+                    are_tuples_compatible<Tuple, UTuple>::value>
+        {
+        };
+
+        template <typename T, typename UTuple>
+        struct is_tuple_converting_constructible<tuple<T>, UTuple>
+          : std::integral_constant<bool,
+                !std::is_same<tuple<T>,
+                    typename std::decay<UTuple>::type>::value &&
+                    !std::is_constructible<T, UTuple>::value &&
+                    are_tuples_compatible<tuple<T>, UTuple>::value>
+        {
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // std::swap is not constexpr before C++20, elements are swapped by
+        // moving them instead during constant evaluation
+        template <typename T>
+        constexpr __host__ __device__ inline void constexpr_swap(
+            T& lhs, T& rhs)
+        {
+            if constexpr (std::is_move_constructible<T>::value &&
+                std::is_move_assignable<T>::value)
+            {
+                T tmp = std::move(lhs);
+                lhs = std::move(rhs);
+                rhs = std::move(tmp);
+            }
+            else
+            {
+                using std::swap;
+                swap(lhs, rhs);
+            }
         }
 
-        // tuple& operator=(tuple&& u) noexcept(see below );
+        template <std::size_t Size>
+        __host__ __device__ inline void bulk_swap(
+            void* lhs, void* rhs) noexcept
+        {
+            // memcpy requires the source and the destination not to overlap
+            if (lhs == rhs)
+                return;
+
+            unsigned char tmp[Size];
+            std::memcpy(tmp, lhs, Size);
+            std::memcpy(lhs, rhs, Size);
+            std::memcpy(rhs, tmp, Size);
+        }
+
+        template <typename Is, typename... Ts>
+        struct tuple_impl;
+
+        template <std::size_t... Is, typename... Ts>
+        struct tuple_impl<util::index_pack<Is...>, Ts...>
+          : tuple_member<Is, Ts>...
+        {
+            // 20.4.2.1, tuple construction
+            constexpr __host__ __device__ tuple_impl()
+              : tuple_member<Is, Ts>()...
+            {
+            }
+
+            template <typename... Us>
+            explicit constexpr __host__ __device__ tuple_impl(
+                std::true_type /*elements*/, Us&&... vs)
+              : tuple_member<Is, Ts>(std::forward<Us>(vs))...
+            {
+            }
+
+            template <typename UTuple>
+            explicit constexpr __host__ __device__ tuple_impl(
+                std::false_type /*elements*/, UTuple&& other)
+              : tuple_member<Is, Ts>(
+                    hpx::get<Is>(std::forward<UTuple>(other)))...
+            {
+            }
+
+            tuple_impl(tuple_impl const&) = default;
+            tuple_impl(tuple_impl&&) = default;
+
+            tuple_impl& operator=(tuple_impl const&) = default;
+            tuple_impl& operator=(tuple_impl&&) = default;
+
+            template <std::size_t I>
+            constexpr __host__ __device__
+                typename util::at_index<I, Ts...>::type&
+                get() noexcept
+            {
+                return static_cast<tuple_member<I,
+                    typename util::at_index<I, Ts...>::type>&>(*this)
+                    .value();
+            }
+
+            template <std::size_t I>
+            constexpr __host__ __device__
+                typename util::at_index<I, Ts...>::type const&
+                get() const noexcept
+            {
+                return static_cast<tuple_member<I,
+                    typename util::at_index<I, Ts...>::type> const&>(*this)
+                    .value();
+            }
+
+            // Elements bound to ignore are skipped, the corresponding elements
+            // of other are not even accessed.
+            template <std::size_t I, typename UTuple,
+                typename T = typename util::at_index<I, Ts...>::type>
+            constexpr __host__ __device__ void assign_element_(
+                UTuple&& other) noexcept(std::is_nothrow_assignable<T&,
+                decltype(hpx::get<I>(std::declval<UTuple>()))>::value)
+            {
+                if constexpr (!is_ignore_member<T>::value)
+                {
+                    this->template get<I>() =
+                        hpx::get<I>(std::forward<UTuple>(other));
+                }
+            }
+
+            template <typename UTuple>
+            constexpr __host__ __device__ void assign_(UTuple&& other) noexcept(
+                (noexcept(std::declval<tuple_impl&>()
+                              .template assign_element_<Is>(
+                                  std::declval<UTuple>())) &&
+                    ...))
+            {
+                (this->template assign_element_<Is>(
+                     std::forward<UTuple>(other)),
+                    ...);
+            }
+
+            constexpr __host__ __device__ void swap_(
+                tuple_impl& other) noexcept(
+                (std::is_nothrow_swappable<Ts>::value && ...))
+            {
+                if (__builtin_is_constant_evaluated())
+                {
+                    (constexpr_swap(
+                         this->template get<Is>(), other.template get<Is>()),
+                        ...);
+                }
+                // trivially copyable elements are swapped as a whole, using
+                // three bulk copies instead of one swap per element
+                else if constexpr (std::is_trivially_copyable<
+                                       tuple_impl>::value)
+                {
+                    bulk_swap<sizeof(tuple_impl)>(this, &other);
+                }
+                else
+                {
+                    using std::swap;
+                    (swap(this->template get<Is>(), other.template get<Is>()),
+                        ...);
+                }
+            }
+        };
+    }    // namespace detail
+
+    template <typename... Ts>
+    class tuple
+    {
+    public:    // exposition-only
+        detail::tuple_impl<typename util::make_index_pack<sizeof...(Ts)>::type,
+            Ts...>
+            _impl;
+
+    public:
+        // 20.4.2.1, tuple construction
+
+        // constexpr tuple();
+        // Value initializes each element.
+#if defined(HPX_TUPLE_HAVE_INSTRUMENTATION)
+        constexpr __host__ __device__ tuple(
+            detail::tuple_call_site site = detail::tuple_call_site::current())
+          : _impl()
+        {
+            HPX_TUPLE_INSTRUMENT_CALL_SITE(construct, tuple);
+        }
+#else
+        constexpr __host__ __device__ tuple()
+          : _impl()
+        {
+        }
+#endif
+
+        // explicit constexpr tuple(const Types&...);
+        // Initializes each element with the value of the corresponding
+        // parameter.
+        explicit constexpr __host__ __device__ tuple(
+            Ts const&... vs HPX_TUPLE_CALL_SITE)
+          : _impl(std::true_type{}, vs...)
+        {
+            HPX_TUPLE_INSTRUMENT_CALL_SITE(construct, tuple);
+        }
+
+        // template <class... UTypes>
+        // explicit constexpr tuple(UTypes&&... u);
+        // Initializes the elements in the tuple with the corresponding value
+        // in std::forward<UTypes>(u).
+#if defined(HPX_TUPLE_HAVE_INSTRUMENTATION)
+        // overloaded for up to four arguments to receive the call site, see
+        // tuple_instrumentation.hpp; the constraint is a non-type template
+        // parameter, otherwise the declaration could not be told apart from
+        // the one of the converting constructor
+        template <typename U0,
+            typename std::enable_if<
+                detail::are_elements_constructible<util::pack<Ts...>,
+                    util::pack<U0>>::value &&
+                    !std::is_same<tuple,
+                        typename std::decay<U0>::type>::value,
+                bool>::type = true>
+        explicit constexpr __host__ __device__ tuple(
+            U0&& v0 HPX_TUPLE_CALL_SITE)
+          : _impl(std::true_type{}, std::forward<U0>(v0))
+        {
+            HPX_TUPLE_INSTRUMENT_CALL_SITE(construct, tuple);
+        }
+
+        template <typename U0, typename U1,
+            typename Enable = typename std::enable_if<
+                detail::are_elements_constructible<util::pack<Ts...>,
+                    util::pack<U0, U1>>::value>::type>
+        explicit constexpr __host__ __device__ tuple(
+            U0&& v0, U1&& v1 HPX_TUPLE_CALL_SITE)
+          : _impl(std::true_type{}, std::forward<U0>(v0), std::forward<U1>(v1))
+        {
+            HPX_TUPLE_INSTRUMENT_CALL_SITE(construct, tuple);
+        }
+
+        template <typename U0, typename U1, typename U2,
+            typename Enable = typename std::enable_if<
+                detail::are_elements_constructible<util::pack<Ts...>,
+                    util::pack<U0, U1, U2>>::value>::type>
+        explicit constexpr __host__ __device__ tuple(
+            U0&& v0, U1&& v1, U2&& v2 HPX_TUPLE_CALL_SITE)
+          : _impl(std::true_type{}, std::forward<U0>(v0), std::forward<U1>(v1),
+                std::forward<U2>(v2))
+        {
+            HPX_TUPLE_INSTRUMENT_CALL_SITE(construct, tuple);
+        }
+
+        template <typename U0, typename U1, typename U2, typename U3,
+            typename Enable = typename std::enable_if<
+                detail::are_elements_constructible<util::pack<Ts...>,
+                    util::pack<U0, U1, U2, U3>>::value>::type>
+        explicit constexpr __host__ __device__ tuple(
+            U0&& v0, U1&& v1, U2&& v2, U3&& v3 HPX_TUPLE_CALL_SITE)
+          : _impl(std::true_type{}, std::forward<U0>(v0), std::forward<U1>(v1),
+                std::forward<U2>(v2), std::forward<U3>(v3))
+        {
+            HPX_TUPLE_INSTRUMENT_CALL_SITE(construct, tuple);
+        }
+
+        template <typename U, typename... Us,
+            typename Enable = typename std::enable_if<(sizeof...(Us) > 3) &&
+                detail::are_elements_constructible<util::pack<Ts...>,
+                    util::pack<U, Us...>>::value>::type>
+        explicit constexpr __host__ __device__ tuple(U&& v, Us&&... vs)
+          : _impl(std::true_type{}, std::forward<U>(v), std::forward<Us>(vs)...)
+        {
+            HPX_TUPLE_INSTRUMENT(construct, tuple);
+        }
+#else
+        template <typename U, typename... Us,
+            typename Enable = typename std::enable_if<
+                detail::are_elements_constructible<util::pack<Ts...>,
+                    util::pack<U, Us...>>::value &&
+                (sizeof...(Us) != 0 ||
+                    !std::is_same<tuple,
+                        typename std::decay<U>::type>::value)>::type>
+        explicit constexpr __host__ __device__ tuple(U&& v, Us&&... vs)
+          : _impl(std::true_type{}, std::forward<U>(v), std::forward<Us>(vs)...)
+        {
+        }
+#endif
+
+        // tuple(const tuple& u) = default;
+        // Initializes each element of *this with the corresponding element
+        // of u.
+        // tuple(tuple&& u) = default;
+        // For all i, initializes the ith element of *this with
+        // std::forward<Ti>(get<i>(u)).
+#if defined(HPX_TUPLE_HAVE_INSTRUMENTATION)
+        // user-provided to receive the call site, see tuple_instrumentation.hpp
+        constexpr __host__ __device__ tuple(
+            tuple const& other HPX_TUPLE_CALL_SITE)
+          : _impl(other._impl)
+        {
+            HPX_TUPLE_INSTRUMENT_CALL_SITE(copy, tuple);
+        }
+
+        constexpr __host__ __device__ tuple(tuple&& other HPX_TUPLE_CALL_SITE)
+            noexcept(std::is_nothrow_move_constructible<decltype(_impl)>::value)
+          : _impl(std::move(other._impl))
+        {
+            HPX_TUPLE_INSTRUMENT_CALL_SITE(move, tuple);
+        }
+#else
+        tuple(tuple const& /*other*/) = default;
+        tuple(tuple&& /*other*/) = default;
+#endif
+
+        // template <class... UTypes>
+        // constexpr tuple(const tuple<UTypes...>& u);
+        // template <class... UTypes>
+        // constexpr tuple(tuple<UTypes...>&& u);
+        // For all i, initializes the ith element of *this with
+        // get<i>(std::forward<UTuple>(u)). Any tuple-like type is accepted,
+        // which allows to convert from (and to move the elements of) a
+        // std::tuple, std::pair or std::array in a single pass.
+        template <typename UTuple,
+            typename Enable = typename std::enable_if<
+                detail::is_tuple_converting_constructible<tuple,
+                    UTuple&&>::value>::type>
+        constexpr __host__ __device__ tuple(
+            UTuple&& other HPX_TUPLE_CALL_SITE)
+          : _impl(std::false_type{}, std::forward<UTuple>(other))
+        {
+            HPX_TUPLE_INSTRUMENT_CALL_SITE(convert, tuple);
+        }
+
+        // 20.4.2.2, tuple assignment
+
+        // tuple& operator=(const tuple& u);
+        // Assigns each element of u to the corresponding element of *this.
+        // tuple& operator=(tuple&& u) noexcept(see below);
         // For all i, assigns std::forward<Ti>(get<i>(u)) to get<i>(*this).
-        __host__ __device__ tuple& operator=(tuple&& /*other*/) noexcept
+#if defined(HPX_TUPLE_HAVE_INSTRUMENTATION)
+        constexpr __host__ __device__ tuple& operator=(tuple const& other)
         {
+            HPX_TUPLE_INSTRUMENT(copy_assign, tuple);
+            _impl = other._impl;
+            return *this;
+        }
+
+        constexpr __host__ __device__ tuple& operator=(tuple&& other) noexcept(
+            std::is_nothrow_move_assignable<decltype(_impl)>::value)
+        {
+            HPX_TUPLE_INSTRUMENT(move_assign, tuple);
+            _impl = std::move(other._impl);
+            return *this;
+        }
+#else
+        tuple& operator=(tuple const& /*other*/) = default;
+        tuple& operator=(tuple&& /*other*/) = default;
+#endif
+
+        // template <class... UTypes>
+        // tuple& operator=(const tuple<UTypes...>& u);
+        // template <class... UTypes>
+        // tuple& operator=(tuple<UTypes...>&& u);
+        // For all i, assigns get<i>(std::forward<UTuple>(u)) to get<i>(*this).
+        template <typename UTuple,
+            typename Enable = typename std::enable_if<
+                !std::is_same<tuple,
+                    typename std::decay<UTuple>::type>::value &&
+                detail::are_tuples_assignable<tuple, UTuple&&>::value>::type>
+        constexpr __host__ __device__ tuple& operator=(
+            UTuple&& other) noexcept(noexcept(
+            std::declval<decltype(_impl)&>().assign_(std::declval<UTuple>())))
+        {
+            HPX_TUPLE_INSTRUMENT(convert, tuple);
+            _impl.assign_(std::forward<UTuple>(other));
             return *this;
         }
 
@@ -160,16 +756,99 @@ namespace hpx {
         // void swap(tuple& rhs) noexcept(see below);
         // Calls swap for each element in *this and its corresponding element
         // in rhs.
-        __host__ __device__ void swap(tuple& /*other*/) noexcept {}
+        constexpr __host__ __device__ void swap(tuple& other) noexcept(
+            noexcept(std::declval<decltype(_impl)&>().swap_(
+                std::declval<decltype(_impl)&>())))
+        {
+            _impl.swap_(other._impl);
+        }
 
+        // element access, used by tuple_element<I, tuple>::get
+        template <std::size_t I>
+        constexpr __host__ __device__ typename util::at_index<I, Ts...>::type&
+        get() noexcept
+        {
+            return _impl.template get<I>();
+        }
+
+        template <std::size_t I>
+        constexpr __host__ __device__
+            typename util::at_index<I, Ts...>::type const&
+            get() const noexcept
+        {
+            return _impl.template get<I>();
+        }
     };
 
+    // Types which are not handled explicitly below are still treated as
+    // tuple-like if they implement the protocol used by structured bindings:
+    // std::tuple_size/std::tuple_element and either a member get<I>() or a
+    // get<I>(t) found by argument dependent lookup (or std::get).
+    namespace detail {
+        namespace std_tuple_like {
+
+            // hides hpx::get from unqualified lookup below
+            using std::get;
+
+            template <std::size_t I, typename T>
+            constexpr __host__ __device__ inline auto get_element(
+                T& t, int) noexcept -> decltype(t.template get<I>())
+            {
+                return t.template get<I>();
+            }
+
+            template <std::size_t I, typename T>
+            constexpr __host__ __device__ inline auto get_element(
+                T& t, long) noexcept -> decltype(get<I>(t))
+            {
+                return get<I>(t);
+            }
+        }    // namespace std_tuple_like
+
+        template <typename T, typename Enable = void>
+        struct std_tuple_size
+        {
+        };
+
+        template <typename T>
+        struct std_tuple_size<T,
+            typename util::always_void<decltype(
+                std::tuple_size<T>::value)>::type>
+          : std::integral_constant<std::size_t, std::tuple_size<T>::value>
+        {
+        };
+
+        template <std::size_t I, typename T, typename Enable = void>
+        struct std_tuple_element
+        {
+        };
+
+        template <std::size_t I, typename T>
+        struct std_tuple_element<I, T,
+            typename std::enable_if<(I < std_tuple_size<T>::value)>::type>
+        {
+            using type = typename std::tuple_element<I, T>::type;
+
+            static constexpr __host__ __device__ inline type& get(
+                T& tuple) noexcept
+            {
+                return std_tuple_like::get_element<I>(tuple, 0);
+            }
+
+            static constexpr __host__ __device__ inline type const& get(
+                T const& tuple) noexcept
+            {
+                return std_tuple_like::get_element<I>(tuple, 0);
+            }
+        };
+    }    // namespace detail
+
     // 20.4.2.5, tuple helper classes
 
     // template <class Tuple>
     // class tuple_size
     template <class T>
-    struct tuple_size
+    struct tuple_size : detail::std_tuple_size<T>
     {
     };
 
@@ -209,14 +888,25 @@ namespace hpx {
     // template <size_t I, class Tuple>
     // class tuple_element
     template <std::size_t I, typename T>
-    struct tuple_element
+    struct tuple_element : detail::std_tuple_element<I, T>
     {
     };
 
+    // Element access through a const tuple-like object forwards to the
+    // accessors of the unqualified type, so that const objects (including
+    // std::array's of const elements) can be accessed in place.
     template <std::size_t I, typename T>
     struct tuple_element<I, const T>
       : std::add_const<typename tuple_element<I, T>::type>
     {
+        using type = typename std::add_const<
+            typename tuple_element<I, T>::type>::type;
+
+        static constexpr __host__ __device__ inline type& get(
+            T const& tuple) noexcept
+        {
+            return tuple_element<I, T>::get(tuple);
+        }
     };
 
     template <std::size_t I, typename T>
@@ -311,7 +1001,7 @@ namespace hpx {
         // get(tuple<Types...>& t) noexcept;
         template <std::size_t I, typename Tuple, typename Enable>
         constexpr __host__ __device__ inline
-            typename tuple_element<I, Tuple>::type&
+            detail::tuple_element_get_t<I, Tuple>
             get(Tuple& t) noexcept
         {
             return tuple_element<I, Tuple>::get(t);
@@ -322,7 +1012,7 @@ namespace hpx {
         // get(const tuple<Types...>& t) noexcept;
         template <std::size_t I, typename Tuple, typename Enable>
         constexpr __host__ __device__ inline
-            typename tuple_element<I, Tuple>::type const&
+            detail::tuple_element_get_t<I, Tuple, Tuple const&>
             get(Tuple const& t) noexcept
         {
             return tuple_element<I, Tuple>::get(t);
@@ -333,11 +1023,22 @@ namespace hpx {
         // get(tuple<Types...>&& t) noexcept;
         template <std::size_t I, typename Tuple, typename Enable>
         constexpr __host__ __device__ inline
-            typename tuple_element<I, Tuple>::type&&
-            get(Tuple&& t) noexcept
+            detail::tuple_element_rvalue_get_t<I, Tuple,
+                typename tuple_element<I, Tuple>::type>
+            get(Tuple&& t HPX_TUPLE_CALL_SITE_REDECL) noexcept
         {
-            return std::forward<typename tuple_element<I, Tuple>::type>(
-                get<I>(t));
+            HPX_TUPLE_INSTRUMENT_CALL_SITE(
+                rvalue_get, typename std::decay<Tuple>::type);
+            if constexpr (std::is_lvalue_reference<
+                              detail::tuple_element_get_t<I, Tuple>>::value)
+            {
+                return std::forward<typename tuple_element<I, Tuple>::type>(
+                    get<I>(t));
+            }
+            else
+            {
+                return get<I>(static_cast<Tuple const&>(t));
+            }
         }
 
         // template <size_t I, class... Types>
@@ -345,11 +1046,21 @@ namespace hpx {
         // get(const tuple<Types...>&& t) noexcept;
         template <std::size_t I, typename Tuple, typename Enable>
         constexpr __host__ __device__ inline
-            typename tuple_element<I, Tuple>::type const&&
-            get(Tuple const&& t) noexcept
+            detail::tuple_element_rvalue_get_t<I, Tuple,
+                typename tuple_element<I, Tuple>::type const>
+            get(Tuple const&& t HPX_TUPLE_CALL_SITE_REDECL) noexcept
         {
-            return std::forward<typename tuple_element<I, Tuple>::type const>(
-                get<I>(t));
+            HPX_TUPLE_INSTRUMENT_CALL_SITE(rvalue_get, Tuple);
+            if constexpr (std::is_lvalue_reference<
+                              detail::tuple_element_get_t<I, Tuple>>::value)
+            {
+                return std::forward<
+                    typename tuple_element<I, Tuple>::type const>(get<I>(t));
+            }
+            else
+            {
+                return get<I>(t);
+            }
         }
     }    // namespace adl_barrier
 
@@ -374,8 +1085,9 @@ namespace hpx {
         template <std::size_t I, typename... Ts>
         constexpr __host__ __device__ inline
             typename tuple_element<I, tuple<Ts...>>::type&&
-            get(tuple<Ts...>&& t) noexcept
+            get(tuple<Ts...>&& t HPX_TUPLE_CALL_SITE_REDECL) noexcept
         {
+            HPX_TUPLE_INSTRUMENT_CALL_SITE(rvalue_get, tuple<Ts...>);
             return std::forward<typename tuple_element<I, tuple<Ts...>>::type>(
                 get<I>(t));
         }
@@ -383,15 +1095,51 @@ namespace hpx {
         template <std::size_t I, typename... Ts>
         constexpr __host__ __device__ inline
             typename tuple_element<I, tuple<Ts...>>::type const&&
-            get(tuple<Ts...> const&& t) noexcept
+            get(tuple<Ts...> const&& t HPX_TUPLE_CALL_SITE_REDECL) noexcept
         {
+            HPX_TUPLE_INSTRUMENT_CALL_SITE(rvalue_get, tuple<Ts...>);
             return std::forward<
                 typename tuple_element<I, tuple<Ts...>>::type const>(get<I>(t));
         }
+
+        // get<T>(t) accesses the only element of type T
+        template <typename T, typename... Ts>
+        struct tuple_index_of_type
+          : util::index_of<T, util::pack<Ts...>>
+        {
+            static_assert(util::count_of<T, util::pack<Ts...>>::value == 1,
+                "the type has to occur exactly once in the tuple");
+        };
+
+        template <typename T, typename... Ts>
+        constexpr __host__ __device__ inline T& get(tuple<Ts...>& t) noexcept
+        {
+            return get<tuple_index_of_type<T, Ts...>::value>(t);
+        }
+
+        template <typename T, typename... Ts>
+        constexpr __host__ __device__ inline T const& get(
+            tuple<Ts...> const& t) noexcept
+        {
+            return get<tuple_index_of_type<T, Ts...>::value>(t);
+        }
+
+        template <typename T, typename... Ts>
+        constexpr __host__ __device__ inline T&& get(tuple<Ts...>&& t) noexcept
+        {
+            return get<tuple_index_of_type<T, Ts...>::value>(std::move(t));
+        }
+
+        template <typename T, typename... Ts>
+        constexpr __host__ __device__ inline T const&& get(
+            tuple<Ts...> const&& t) noexcept
+        {
+            return get<tuple_index_of_type<T, Ts...>::value>(std::move(t));
+        }
     }    // namespace std_adl_barrier
 
     // 20.4.2.4, tuple creation functions
-    detail::ignore_type const ignore = {};
+    inline constexpr detail::ignore_type ignore = {};
 
     // template<class... Types>
     // tuple<Types&&...> forward_as_tuple(Types&&... t) noexcept;
@@ -399,128 +1147,414 @@ namespace hpx {
     // forwarding as arguments to a function. Because the result may contain
     // references to temporary variables, a program shall ensure that the
     // return value of this function does not outlive any of its arguments.
+#if defined(HPX_TUPLE_HAVE_INSTRUMENTATION)
+    // forward_as_tuple, tie and tuple_cat are overloaded for up to four
+    // arguments to receive the call site, see tuple_instrumentation.hpp
+    namespace detail {
+        template <typename... Ts>
+        constexpr __host__ __device__ inline tuple<Ts&&...>
+        forward_as_tuple_at(tuple_call_site site, Ts&&... vs) noexcept
+        {
+            HPX_TUPLE_INSTRUMENT_CALL_SITE(forward_as_tuple, tuple<Ts&&...>);
+            if constexpr (sizeof...(Ts) == 0)
+                return tuple<>();
+            else
+                return tuple<Ts&&...>(std::forward<Ts>(vs)..., site);
+        }
+
+        template <typename... Ts>
+        constexpr __host__ __device__ inline tuple<Ts&...> tie_at(
+            tuple_call_site site, Ts&... vs) noexcept
+        {
+            HPX_TUPLE_INSTRUMENT_CALL_SITE(tie, tuple<Ts&...>);
+            if constexpr (sizeof...(Ts) == 0)
+                return tuple<>();
+            else
+                return tuple<Ts&...>(vs..., site);
+        }
+    }    // namespace detail
+
+    constexpr __host__ __device__ inline tuple<> forward_as_tuple(
+        detail::tuple_call_site site =
+            detail::tuple_call_site::current()) noexcept
+    {
+        return detail::forward_as_tuple_at(site);
+    }
+
+    template <typename T0>
+    constexpr __host__ __device__ inline tuple<T0&&> forward_as_tuple(
+        T0&& v0 HPX_TUPLE_CALL_SITE) noexcept
+    {
+        return detail::forward_as_tuple_at(site, std::forward<T0>(v0));
+    }
+
+    template <typename T0, typename T1>
+    constexpr __host__ __device__ inline tuple<T0&&, T1&&> forward_as_tuple(
+        T0&& v0, T1&& v1 HPX_TUPLE_CALL_SITE) noexcept
+    {
+        return detail::forward_as_tuple_at(
+            site, std::forward<T0>(v0), std::forward<T1>(v1));
+    }
+
+    template <typename T0, typename T1, typename T2>
+    constexpr __host__ __device__ inline tuple<T0&&, T1&&, T2&&>
+    forward_as_tuple(T0&& v0, T1&& v1, T2&& v2 HPX_TUPLE_CALL_SITE) noexcept
+    {
+        return detail::forward_as_tuple_at(site, std::forward<T0>(v0),
+            std::forward<T1>(v1), std::forward<T2>(v2));
+    }
+
+    template <typename T0, typename T1, typename T2, typename T3>
+    constexpr __host__ __device__ inline tuple<T0&&, T1&&, T2&&, T3&&>
+    forward_as_tuple(
+        T0&& v0, T1&& v1, T2&& v2, T3&& v3 HPX_TUPLE_CALL_SITE) noexcept
+    {
+        return detail::forward_as_tuple_at(site, std::forward<T0>(v0),
+            std::forward<T1>(v1), std::forward<T2>(v2), std::forward<T3>(v3));
+    }
+
+    template <typename... Ts,
+        typename Enable = typename std::enable_if<(sizeof...(Ts) > 4)>::type>
+    constexpr __host__ __device__ inline tuple<Ts&&...> forward_as_tuple(
+        Ts&&... vs) noexcept
+    {
+        HPX_TUPLE_INSTRUMENT(forward_as_tuple, tuple<Ts&&...>);
+        return tuple<Ts&&...>(std::forward<Ts>(vs)...);
+    }
+#else
     template <typename... Ts>
-    __host__ __device__ inline tuple<Ts&&...> forward_as_tuple(
+    constexpr __host__ __device__ inline tuple<Ts&&...> forward_as_tuple(
         Ts&&... vs) noexcept
     {
         return tuple<Ts&&...>(std::forward<Ts>(vs)...);
     }
+#endif
 
     // template<class... Types>
     // tuple<Types&...> tie(Types&... t) noexcept;
+#if defined(HPX_TUPLE_HAVE_INSTRUMENTATION)
+    constexpr __host__ __device__ inline tuple<> tie(
+        detail::tuple_call_site site =
+            detail::tuple_call_site::current()) noexcept
+    {
+        return detail::tie_at(site);
+    }
+
+    template <typename T0>
+    constexpr __host__ __device__ inline tuple<T0&> tie(
+        T0& v0 HPX_TUPLE_CALL_SITE) noexcept
+    {
+        return detail::tie_at(site, v0);
+    }
+
+    template <typename T0, typename T1>
+    constexpr __host__ __device__ inline tuple<T0&, T1&> tie(
+        T0& v0, T1& v1 HPX_TUPLE_CALL_SITE) noexcept
+    {
+        return detail::tie_at(site, v0, v1);
+    }
+
+    template <typename T0, typename T1, typename T2>
+    constexpr __host__ __device__ inline tuple<T0&, T1&, T2&> tie(
+        T0& v0, T1& v1, T2& v2 HPX_TUPLE_CALL_SITE) noexcept
+    {
+        return detail::tie_at(site, v0, v1, v2);
+    }
+
+    template <typename T0, typename T1, typename T2, typename T3>
+    constexpr __host__ __device__ inline tuple<T0&, T1&, T2&, T3&> tie(
+        T0& v0, T1& v1, T2& v2, T3& v3 HPX_TUPLE_CALL_SITE) noexcept
+    {
+        return detail::tie_at(site, v0, v1, v2, v3);
+    }
+
+    template <typename... Ts,
+        typename Enable = typename std::enable_if<(sizeof...(Ts) > 4)>::type>
+    constexpr __host__ __device__ inline tuple<Ts&...> tie(Ts&... vs) noexcept
+    {
+        HPX_TUPLE_INSTRUMENT(tie, tuple<Ts&...>);
+        return tuple<Ts&...>(vs...);
+    }
+#else
     template <typename... Ts>
-    __host__ __device__ inline tuple<Ts&...> tie(Ts&... vs) noexcept
+    constexpr __host__ __device__ inline tuple<Ts&...> tie(Ts&... vs) noexcept
     {
         return tuple<Ts&...>(vs...);
     }
+#endif
 
     //template <class... Tuples>
     //constexpr tuple<Ctypes ...> tuple_cat(Tuples&&...);
     namespace detail {
 
-        /// Deduces to the overall size of all given tuples
-        template <std::size_t Size, typename Tuples>
-        struct tuple_cat_size_impl;
+        // The result type of tuple_cat is computed by flattening the inputs:
+        // every distinct input tuple type is expanded once into the pack of
+        // its element types, and the resulting packs are concatenated. Along
+        // with the element types the flattening yields, for every element of
+        // the result, the index of the input it comes from (outer) and its
+        // index within that input (inner).
+        template <typename Tuple,
+            typename Indices =
+                typename util::make_index_pack<tuple_size<Tuple>::value>::type>
+        struct tuple_cat_flatten_one;
+
+        template <typename Tuple, std::size_t... Is>
+        struct tuple_cat_flatten_one<Tuple, util::index_pack<Is...>>
+        {
+            using elements =
+                util::pack<typename tuple_element<Is, Tuple>::type...>;
+            using inner = util::index_pack<Is...>;
+        };
 
-        template <std::size_t Size>
-        struct tuple_cat_size_impl<Size, util::pack<>>
-          : std::integral_constant<std::size_t, Size>
+        template <std::size_t K, typename Inner>
+        struct tuple_cat_outer;
+
+        template <std::size_t K, std::size_t... Is>
+        struct tuple_cat_outer<K, util::index_pack<Is...>>
         {
+            using type = util::index_pack<(Is * 0 + K)...>;
         };
 
-        template <std::size_t Size, typename Head, typename... Tail>
-        struct tuple_cat_size_impl<Size, util::pack<Head, Tail...>>
-          : tuple_cat_size_impl<(Size + tuple_size<Head>::value),
-                util::pack<Tail...>>
+        template <typename Ks, typename... Tuples>
+        struct tuple_cat_flatten_impl;
+
+        template <std::size_t... Ks, typename... Tuples>
+        struct tuple_cat_flatten_impl<util::index_pack<Ks...>, Tuples...>
         {
+            using elements = typename util::concat<
+                typename tuple_cat_flatten_one<Tuples>::elements...>::type;
+            using outer = typename util::concat<typename tuple_cat_outer<Ks,
+                typename tuple_cat_flatten_one<Tuples>::inner>::type...>::type;
+            using inner = typename util::concat<
+                typename tuple_cat_flatten_one<Tuples>::inner...>::type;
         };
 
         template <typename... Tuples>
-        struct tuple_cat_size : tuple_cat_size_impl<0, util::pack<Tuples...>>
+        struct tuple_cat_flatten
+          : tuple_cat_flatten_impl<
+                typename util::make_index_pack<sizeof...(Tuples)>::type,
+                Tuples...>
+        {
+        };
+
+        template <>
+        struct tuple_cat_flatten<>
         {
+            using elements = util::pack<>;
+            using outer = util::index_pack<>;
+            using inner = util::index_pack<>;
         };
 
         ///////////////////////////////////////////////////////////////////////
-        template <std::size_t I, typename Tuples, typename Enable = void>
-        struct tuple_cat_element;
+        template <typename Tuples,
+            typename Elements = typename Tuples::elements>
+        struct tuple_cat_result_impl;
 
-        template <std::size_t I, typename Head, typename... Tail>
-        struct tuple_cat_element<I, util::pack<Head, Tail...>,
-            typename std::enable_if<(I < tuple_size<Head>::value)>::type>
-          : tuple_element<I, Head>
+        template <typename Flatten, typename... Ts>
+        struct tuple_cat_result_impl<Flatten, util::pack<Ts...>>
         {
-            template <typename THead, typename... TTail>
-            static constexpr __host__ __device__ inline auto get(
-                THead&& head, TTail&&... /*tail*/) noexcept
-                -> decltype(hpx::get<I>(std::forward<THead>(head)))
-            {
-                return hpx::get<I>(std::forward<THead>(head));
-            }
+            using type = tuple<Ts...>;
         };
 
-        template <std::size_t I, typename Head, typename... Tail>
-        struct tuple_cat_element<I, util::pack<Head, Tail...>,
-            typename std::enable_if<(I >= tuple_size<Head>::value)>::type>
-          : tuple_cat_element<I - tuple_size<Head>::value, util::pack<Tail...>>
+        template <typename... Tuples>
+        struct tuple_cat_result
+          : tuple_cat_result_impl<tuple_cat_flatten<Tuples...>>
         {
-            using _members = tuple_cat_element<I - tuple_size<Head>::value,
-                util::pack<Tail...>>;
+        };
 
-            template <typename THead, typename... TTail>
-            static constexpr __host__ __device__ inline auto get(
-                THead&& /*head*/, TTail&&... tail) noexcept
-                -> decltype(_members::get(std::forward<TTail>(tail)...))
-            {
-                return _members::get(std::forward<TTail>(tail)...);
-            }
+        // Concatenating only std::array's of the same element type yields a
+        // std::array again.
+        template <typename T, std::size_t... Sizes>
+        struct tuple_cat_result<std::array<T, Sizes>...>
+        {
+            using type = std::array<T, (Sizes + ... + 0)>;
         };
 
-        ///////////////////////////////////////////////////////////////////////
-        template <typename Indices, typename Tuples>
-        struct tuple_cat_result_impl;
+        template <typename... Tuples>
+        using tuple_cat_result_of_t = typename tuple_cat_result<
+            typename std::decay<Tuples>::type...>::type;
+
+        template <std::size_t Outer, std::size_t Inner, typename Refs>
+        constexpr __host__ __device__ inline decltype(auto) tuple_cat_get(
+            Refs& refs) noexcept
+        {
+            using outer_type = typename tuple_element<Outer, Refs>::type;
+            return hpx::get<Inner>(std::forward<outer_type>(
+                tuple_element<Outer, Refs>::get(refs)));
+        }
 
-        template <std::size_t... Is, typename... Tuples>
-        struct tuple_cat_result_impl<util::index_pack<Is...>,
-            util::pack<Tuples...>>
+        template <std::size_t... Outer, std::size_t... Inner,
+            typename... Tuples, typename... Tuples_>
+        constexpr __host__ __device__ inline tuple_cat_result_of_t<Tuples...>
+        tuple_cat_impl(util::index_pack<Outer...>, util::index_pack<Inner...>,
+            util::pack<Tuples...>, Tuples_&&... tuples)
+        {
+            tuple<Tuples_&&...> refs(std::forward<Tuples_>(tuples)...);
+            (void) refs;
+            return tuple_cat_result_of_t<Tuples...>{
+                tuple_cat_get<Outer, Inner>(refs)...};
+        }
+
+        template <typename T, std::size_t Size>
+        constexpr __host__ __device__ inline T* array_cat_copy(
+            T* dest, std::array<T, Size> const& src) noexcept
+        {
+            if (__builtin_is_constant_evaluated())
+            {
+                for (std::size_t i = 0; i != Size; ++i)
+                    dest[i] = src[i];
+            }
+            else if (Size != 0)
+            {
+                std::memcpy(dest, src.data(), Size * sizeof(T));
+            }
+            return dest + Size;
+        }
+
+        // Arrays of trivially copyable elements are concatenated with a
+        // single bulk copy per input array. The result is default constructed
+        // first, arrays of const or not default constructible elements are
+        // therefore concatenated element by element.
+        template <typename T>
+        struct is_bulk_array_cat
+          : std::integral_constant<bool,
+                std::is_trivially_copyable<T>::value &&
+                    !std::is_const<T>::value &&
+                    std::is_default_constructible<T>::value>
         {
-            using type = tuple<
-                typename tuple_cat_element<Is, util::pack<Tuples...>>::type...>;
         };
 
-        template <typename Indices, typename Tuples>
-        using tuple_cat_result_of_t =
-            typename tuple_cat_result_impl<Indices, Tuples>::type;
+        template <std::size_t... Outer, std::size_t... Inner, typename T,
+            std::size_t... Sizes, typename... Arrays>
+        constexpr __host__ __device__ inline typename std::enable_if<
+            is_bulk_array_cat<T>::value, std::array<T, sizeof...(Inner)>>::type
+        tuple_cat_impl(util::index_pack<Outer...>, util::index_pack<Inner...>,
+            util::pack<std::array<T, Sizes>...>, Arrays&&... arrays)
+        {
+            std::array<T, sizeof...(Inner)> result{};
+            T* dest = result.data();
+            ((dest = array_cat_copy(dest, arrays)), ...);
+            (void) dest;
+            return result;
+        }
+    }    // namespace detail
 
-        template <std::size_t... Is, typename... Tuples, typename... Tuples_>
-        constexpr __host__ __device__ inline auto tuple_cat_impl(
-            util::index_pack<Is...> is_pack, util::pack<Tuples...> tuple_pack,
-            Tuples_&&... tuples)
-            -> tuple_cat_result_of_t<decltype(is_pack), decltype(tuple_pack)>
+    namespace detail {
+        template <typename... Tuples>
+        constexpr __host__ __device__ inline tuple_cat_result_of_t<Tuples...>
+        tuple_cat_(Tuples&&... tuples)
         {
-            return tuple_cat_result_of_t<decltype(is_pack),
-                decltype(tuple_pack)>{
-                tuple_cat_element<Is, util::pack<Tuples...>>::get(
-                    std::forward<Tuples_>(tuples)...)...};
+            using flatten =
+                tuple_cat_flatten<typename std::decay<Tuples>::type...>;
+
+            return tuple_cat_impl(typename flatten::outer{},
+                typename flatten::inner{},
+                util::pack<typename std::decay<Tuples>::type...>{},
+                std::forward<Tuples>(tuples)...);
         }
     }    // namespace detail
 
+#if defined(HPX_TUPLE_HAVE_INSTRUMENTATION)
+    // The tuples tuple_cat constructs internally are counted at the lines of
+    // this library constructing them.
+    constexpr __host__ __device__ inline tuple<> tuple_cat(
+        detail::tuple_call_site site = detail::tuple_call_site::current())
+    {
+        HPX_TUPLE_INSTRUMENT_CALL_SITE(tuple_cat, tuple<>);
+        return tuple<>();
+    }
+
+    template <typename T0>
+    constexpr __host__ __device__ inline detail::tuple_cat_result_of_t<T0>
+    tuple_cat(T0&& t0 HPX_TUPLE_CALL_SITE)
+    {
+        HPX_TUPLE_INSTRUMENT_CALL_SITE(
+            tuple_cat, detail::tuple_cat_result_of_t<T0>);
+        return detail::tuple_cat_(std::forward<T0>(t0));
+    }
+
+    template <typename T0, typename T1>
+    constexpr __host__ __device__ inline detail::tuple_cat_result_of_t<T0, T1>
+    tuple_cat(T0&& t0, T1&& t1 HPX_TUPLE_CALL_SITE)
+    {
+        HPX_TUPLE_INSTRUMENT_CALL_SITE(
+            tuple_cat, detail::tuple_cat_result_of_t<T0, T1>);
+        return detail::tuple_cat_(std::forward<T0>(t0), std::forward<T1>(t1));
+    }
+
+    template <typename T0, typename T1, typename T2>
+    constexpr __host__ __device__ inline detail::tuple_cat_result_of_t<T0, T1,
+        T2>
+    tuple_cat(T0&& t0, T1&& t1, T2&& t2 HPX_TUPLE_CALL_SITE)
+    {
+        HPX_TUPLE_INSTRUMENT_CALL_SITE(
+            tuple_cat, detail::tuple_cat_result_of_t<T0, T1, T2>);
+        return detail::tuple_cat_(std::forward<T0>(t0), std::forward<T1>(t1),
+            std::forward<T2>(t2));
+    }
+
+    template <typename T0, typename T1, typename T2, typename T3>
+    constexpr __host__ __device__ inline detail::tuple_cat_result_of_t<T0, T1,
+        T2, T3>
+    tuple_cat(T0&& t0, T1&& t1, T2&& t2, T3&& t3 HPX_TUPLE_CALL_SITE)
+    {
+        HPX_TUPLE_INSTRUMENT_CALL_SITE(
+            tuple_cat, detail::tuple_cat_result_of_t<T0, T1, T2, T3>);
+        return detail::tuple_cat_(std::forward<T0>(t0), std::forward<T1>(t1),
+            std::forward<T2>(t2), std::forward<T3>(t3));
+    }
+
+    template <typename... Tuples,
+        typename Enable =
+            typename std::enable_if<(sizeof...(Tuples) > 4)>::type>
+    constexpr __host__ __device__ inline detail::tuple_cat_result_of_t<
+        Tuples...>
+    tuple_cat(Tuples&&... tuples)
+    {
+        HPX_TUPLE_INSTRUMENT(
+            tuple_cat, detail::tuple_cat_result_of_t<Tuples...>);
+        return detail::tuple_cat_(std::forward<Tuples>(tuples)...);
+    }
+#else
     template <typename... Tuples>
-    constexpr __host__ __device__ inline auto tuple_cat(Tuples&&... tuples)
-        -> decltype(detail::tuple_cat_impl(
-            typename util::make_index_pack<detail::tuple_cat_size<
-                typename std::decay<Tuples>::type...>::value>::type{},
-            util::pack<typename std::decay<Tuples>::type...>{},
-            std::forward<Tuples>(tuples)...))
-    {
-        return detail::tuple_cat_impl(
-            typename util::make_index_pack<detail::tuple_cat_size<
-                typename std::decay<Tuples>::type...>::value>::type{},
-            util::pack<typename std::decay<Tuples>::type...>{},
-            std::forward<Tuples>(tuples)...);
+    constexpr __host__ __device__ inline detail::tuple_cat_result_of_t<
+        Tuples...>
+    tuple_cat(Tuples&&... tuples)
+    {
+        return detail::tuple_cat_(std::forward<Tuples>(tuples)...);
     }
+#endif
 
     // 20.4.2.7, relational operators
 
+    // In addition to comparing two tuples, any tuple may be compared with any
+    // other tuple-like type of the same size (std::pair, std::array, ...).
+    namespace detail {
+        template <typename T>
+        struct is_tuple : std::false_type
+        {
+        };
+
+        template <typename... Ts>
+        struct is_tuple<tuple<Ts...>> : std::true_type
+        {
+        };
+
+        template <typename TTuple, typename UTuple, typename Enable = void>
+        struct enable_tuple_comparison
+        {
+        };
+
+        template <typename TTuple, typename UTuple>
+        struct enable_tuple_comparison<TTuple, UTuple,
+            typename std::enable_if<(is_tuple<TTuple>::value ||
+                                        is_tuple<UTuple>::value) &&
+                tuple_size<TTuple>::value == tuple_size<UTuple>::value>::type>
+        {
+            using type = bool;
+        };
+    }    // namespace detail
+
     // template<class... TTypes, class... UTypes>
     // constexpr bool operator==
     //     (const tuple<TTypes...>& t, const tuple<UTypes...>& u);
@@ -552,21 +1586,21 @@ namespace hpx {
         };
     }    // namespace detail
 
-    template <typename... Ts, typename... Us>
+    template <typename TTuple, typename UTuple>
     constexpr __host__ __device__ inline
-        typename std::enable_if<sizeof...(Ts) == sizeof...(Us), bool>::type
-        operator==(tuple<Ts...> const& t, tuple<Us...> const& u)
+        typename detail::enable_tuple_comparison<TTuple, UTuple>::type
+        operator==(TTuple const& t, UTuple const& u)
     {
-        return detail::tuple_equal_to<0, sizeof...(Ts)>::call(t, u);
+        return detail::tuple_equal_to<0, tuple_size<TTuple>::value>::call(t, u);
     }
 
     // template<class... TTypes, class... UTypes>
     // constexpr bool operator!=
     //     (const tuple<TTypes...>& t, const tuple<UTypes...>& u);
-    template <typename... Ts, typename... Us>
+    template <typename TTuple, typename UTuple>
     constexpr __host__ __device__ inline
-        typename std::enable_if<sizeof...(Ts) == sizeof...(Us), bool>::type
-        operator!=(tuple<Ts...> const& t, tuple<Us...> const& u)
+        typename detail::enable_tuple_comparison<TTuple, UTuple>::type
+        operator!=(TTuple const& t, UTuple const& u)
     {
         return !(t == u);
     }
@@ -604,21 +1638,22 @@ namespace hpx {
         };
     }    // namespace detail
 
-    template <typename... Ts, typename... Us>
+    template <typename TTuple, typename UTuple>
     constexpr __host__ __device__ inline
-        typename std::enable_if<sizeof...(Ts) == sizeof...(Us), bool>::type
-        operator<(tuple<Ts...> const& t, tuple<Us...> const& u)
+        typename detail::enable_tuple_comparison<TTuple, UTuple>::type
+        operator<(TTuple const& t, UTuple const& u)
     {
-        return detail::tuple_less_than<0, sizeof...(Ts)>::call(t, u);
+        return detail::tuple_less_than<0, tuple_size<TTuple>::value>::call(
+            t, u);
     }
 
     // template<class... TTypes, class... UTypes>
     // constexpr bool operator>
     //     (const tuple<TTypes...>& t, const tuple<UTypes...>& u);
-    template <typename... Ts, typename... Us>
+    template <typename TTuple, typename UTuple>
     constexpr __host__ __device__ inline
-        typename std::enable_if<sizeof...(Ts) == sizeof...(Us), bool>::type
-        operator>(tuple<Ts...> const& t, tuple<Us...> const& u)
+        typename detail::enable_tuple_comparison<TTuple, UTuple>::type
+        operator>(TTuple const& t, UTuple const& u)
     {
         return u < t;
     }
@@ -626,10 +1661,10 @@ namespace hpx {
     // template<class... TTypes, class... UTypes>
     // constexpr bool operator<=
     //     (const tuple<TTypes...>& t, const tuple<UTypes...>& u);
-    template <typename... Ts, typename... Us>
+    template <typename TTuple, typename UTuple>
     constexpr __host__ __device__ inline
-        typename std::enable_if<sizeof...(Ts) == sizeof...(Us), bool>::type
-        operator<=(tuple<Ts...> const& t, tuple<Us...> const& u)
+        typename detail::enable_tuple_comparison<TTuple, UTuple>::type
+        operator<=(TTuple const& t, UTuple const& u)
     {
         return !(u < t);
     }
@@ -637,10 +1672,10 @@ namespace hpx {
     // template<class... TTypes, class... UTypes>
     // constexpr bool operator>=
     //     (const tuple<TTypes...>& t, const tuple<UTypes...>& u);
-    template <typename... Ts, typename... Us>
+    template <typename TTuple, typename UTuple>
     constexpr __host__ __device__ inline
-        typename std::enable_if<sizeof...(Ts) == sizeof...(Us), bool>::type
-        operator>=(tuple<Ts...> const& t, tuple<Us...> const& u)
+        typename detail::enable_tuple_comparison<TTuple, UTuple>::type
+        operator>=(TTuple const& t, UTuple const& u)
     {
         return !(t < u);
     }
@@ -651,7 +1686,7 @@ namespace hpx {
     // void swap(tuple<Types...>& x, tuple<Types...>& y) noexcept(x.swap(y));
     // x.swap(y)
     template <typename... Ts>
-    __host__ __device__ inline void swap(
+    constexpr __host__ __device__ inline void swap(
         tuple<Ts...>& x, tuple<Ts...>& y) noexcept(noexcept(x.swap(y)))
     {
         x.swap(y);
@@ -660,6 +1695,28 @@ namespace hpx {
 }    // namespace hpx
 
 
+// Make tuple usable with structured bindings and with code relying on
+// std::tuple_size/std::tuple_element/std::get without converting it first.
+// Note that library functions calling std::get from within <tuple> (e.g.
+// std::apply) have already bound the name before these declarations, use
+// hpx::invoke_fused instead.
+namespace std {
+
+    template <typename... Ts>
+    struct tuple_size<hpx::tuple<Ts...>>
+      : std::integral_constant<std::size_t, sizeof...(Ts)>
+    {
+    };
+
+    template <std::size_t I, typename... Ts>
+    struct tuple_element<I, hpx::tuple<Ts...>>
+    {
+        using type = typename hpx::tuple_element<I, hpx::tuple<Ts...>>::type;
+    };
+
+    using hpx::std_adl_barrier::get;
+}    // namespace std
+
 #if defined(HPX_MSVC_WARNING_PRAGMA)
 #pragma warning(pop)
 #endif
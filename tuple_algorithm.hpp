@@ -0,0 +1,149 @@
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Reductions over the elements of tuple-like types. All of them expand into a
+// single fold expression over the element indices instead of recursing over
+// the elements, so unoptimized builds do not produce call chains as deep as
+// the tuple is long. The predicates short-circuit like the relational
+// operators do: no element is accessed after the result has been decided.
+
+#pragma once
+
+#include "try_tuple.hpp"
+
+#include <cstddef>    // for size_t
+#include <type_traits>
+#include <utility>
+
+#include <hip/hip_runtime.h>
+
+namespace hpx {
+
+    namespace detail {
+
+        template <typename Tuple>
+        struct tuple_indices
+          : util::make_index_pack<
+                tuple_size<typename std::decay<Tuple>::type>::value>
+        {
+        };
+
+        // Holds the accumulator of tuple_fold; the type of the accumulator may
+        // change with every step.
+        template <typename F, typename T>
+        struct tuple_fold_state
+        {
+            F& op;
+            T value;
+        };
+
+        template <typename F, typename T, typename U>
+        constexpr __host__ __device__ inline tuple_fold_state<F,
+            typename std::decay<decltype(std::declval<F&>()(
+                std::declval<T&&>(), std::declval<U&&>()))>::type>
+        operator<<(tuple_fold_state<F, T>&& state, U&& elem)
+        {
+            return {state.op,
+                state.op(std::move(state.value), std::forward<U>(elem))};
+        }
+
+        template <std::size_t... Is, typename Tuple, typename T, typename F>
+        constexpr __host__ __device__ inline auto tuple_fold_impl(
+            util::index_pack<Is...>, Tuple&& t, T&& init, F& op)
+        {
+            return (tuple_fold_state<F, typename std::decay<T>::type>{
+                        op, std::forward<T>(init)}
+                << ... << hpx::get<Is>(std::forward<Tuple>(t)))
+                .value;
+        }
+
+        template <std::size_t... Is, typename Tuple, typename F>
+        constexpr __host__ __device__ inline void tuple_for_each_impl(
+            util::index_pack<Is...>, Tuple&& t, F& f)
+        {
+            (f(hpx::get<Is>(std::forward<Tuple>(t))), ...);
+        }
+
+        template <std::size_t... Is, typename Tuple, typename Pred>
+        constexpr __host__ __device__ inline bool tuple_any_impl(
+            util::index_pack<Is...>, Tuple const& t, Pred& pred)
+        {
+            return (static_cast<bool>(pred(hpx::get<Is>(t))) || ...);
+        }
+
+        template <std::size_t... Is, typename Tuple, typename Pred>
+        constexpr __host__ __device__ inline bool tuple_all_impl(
+            util::index_pack<Is...>, Tuple const& t, Pred& pred)
+        {
+            return (static_cast<bool>(pred(hpx::get<Is>(t))) && ...);
+        }
+
+        template <std::size_t... Is, typename Tuple, typename Pred>
+        constexpr __host__ __device__ inline std::size_t tuple_find_if_impl(
+            util::index_pack<Is...>, Tuple const& t, Pred& pred)
+        {
+            std::size_t result = sizeof...(Is);
+            (void) ((pred(hpx::get<Is>(t)) ? (result = Is, true) : false) ||
+                ...);
+            return result;
+        }
+    }    // namespace detail
+
+    // Returns op(...op(op(init, get<0>(t)), get<1>(t))..., get<N-1>(t)). The
+    // type of the intermediate results may differ from step to step.
+    template <typename Tuple, typename T, typename F>
+    constexpr __host__ __device__ inline auto tuple_fold(
+        Tuple&& t, T&& init, F&& op)
+    {
+        return detail::tuple_fold_impl(
+            typename detail::tuple_indices<Tuple>::type{},
+            std::forward<Tuple>(t), std::forward<T>(init), op);
+    }
+
+    // Calls f for each element of t, in order.
+    template <typename Tuple, typename F>
+    constexpr __host__ __device__ inline void tuple_for_each(Tuple&& t, F&& f)
+    {
+        detail::tuple_for_each_impl(
+            typename detail::tuple_indices<Tuple>::type{},
+            std::forward<Tuple>(t), f);
+    }
+
+    // Whether pred holds for any element of t, false for empty tuples.
+    template <typename Tuple, typename Pred>
+    constexpr __host__ __device__ inline bool tuple_any(
+        Tuple const& t, Pred&& pred)
+    {
+        return detail::tuple_any_impl(
+            typename detail::tuple_indices<Tuple>::type{}, t, pred);
+    }
+
+    // Whether pred holds for all elements of t, true for empty tuples.
+    template <typename Tuple, typename Pred>
+    constexpr __host__ __device__ inline bool tuple_all(
+        Tuple const& t, Pred&& pred)
+    {
+        return detail::tuple_all_impl(
+            typename detail::tuple_indices<Tuple>::type{}, t, pred);
+    }
+
+    // Whether pred holds for no element of t, true for empty tuples.
+    template <typename Tuple, typename Pred>
+    constexpr __host__ __device__ inline bool tuple_none(
+        Tuple const& t, Pred&& pred)
+    {
+        return !detail::tuple_any_impl(
+            typename detail::tuple_indices<Tuple>::type{}, t, pred);
+    }
+
+    // Returns the index of the first element of t for which pred holds, or
+    // tuple_size<Tuple>::value if there is none.
+    template <typename Tuple, typename Pred>
+    constexpr __host__ __device__ inline std::size_t tuple_find_if(
+        Tuple const& t, Pred&& pred)
+    {
+        return detail::tuple_find_if_impl(
+            typename detail::tuple_indices<Tuple>::type{}, t, pred);
+    }
+}    // namespace hpx
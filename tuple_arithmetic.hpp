@@ -0,0 +1,385 @@
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Element-wise arithmetic over tuples whose elements are arithmetic scalars or
+// std::array's of arithmetic type. The operators build expression templates
+// on top of tuple_size/get; nothing is computed until the expression is
+// assigned to a destination tuple with tuple_assign, which then evaluates the
+// whole expression in a single pass per element (one tight, vectorizable loop
+// per std::array element).
+
+#pragma once
+
+#include "try_tuple.hpp"
+
+#include <array>
+#include <cstddef>    // for size_t
+#include <type_traits>
+#include <utility>
+
+#include <hip/hip_runtime.h>
+
+namespace hpx {
+
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        // The number of scalar values stored in a single tuple element.
+        template <typename T>
+        struct tuple_field_extent : std::integral_constant<std::size_t, 1>
+        {
+        };
+
+        template <typename Type, std::size_t Size>
+        struct tuple_field_extent<std::array<Type, Size>>
+          : std::integral_constant<std::size_t, Size>
+        {
+        };
+
+        template <typename T>
+        struct is_arithmetic_field : std::is_arithmetic<T>
+        {
+        };
+
+        template <typename Type, std::size_t Size>
+        struct is_arithmetic_field<std::array<Type, Size>>
+          : std::is_arithmetic<Type>
+        {
+        };
+
+        template <typename T>
+        struct is_arithmetic_tuple : std::false_type
+        {
+        };
+
+        template <typename... Ts>
+        struct is_arithmetic_tuple<tuple<Ts...>>
+          : std::integral_constant<bool,
+                (sizeof...(Ts) != 0 && (is_arithmetic_field<Ts>::value && ...))>
+        {
+        };
+
+        // Access the k-th scalar value of a tuple element; scalars have a
+        // single value which is broadcast to all positions.
+        template <typename T>
+        constexpr __host__ __device__ inline T const& tuple_field_at(
+            T const& t, std::size_t /*k*/) noexcept
+        {
+            return t;
+        }
+
+        template <typename Type, std::size_t Size>
+        constexpr __host__ __device__ inline Type const& tuple_field_at(
+            std::array<Type, Size> const& t, std::size_t k) noexcept
+        {
+            return t[k];
+        }
+
+        template <typename T>
+        constexpr __host__ __device__ inline T& tuple_field_at(
+            T& t, std::size_t /*k*/) noexcept
+        {
+            return t;
+        }
+
+        template <typename Type, std::size_t Size>
+        constexpr __host__ __device__ inline Type& tuple_field_at(
+            std::array<Type, Size>& t, std::size_t k) noexcept
+        {
+            return t[k];
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Expression nodes. Every node exposes its tuple size (0 for scalars,
+        // which broadcast to any size), eval<I>(k), which yields the k-th
+        // scalar value of the I-th element of the expression, and fits<I, N>,
+        // which is true if all array operands of the I-th element hold
+        // exactly N values (only scalars are broadcast).
+        template <typename Tuple>
+        struct tuple_expr_terminal
+        {
+            static constexpr std::size_t size = tuple_size<Tuple>::value;
+
+            template <std::size_t I, std::size_t N>
+            static constexpr bool fits() noexcept
+            {
+                using field_type = typename std::decay<
+                    typename tuple_element<I, Tuple>::type>::type;
+                return std::is_arithmetic<field_type>::value ||
+                    tuple_field_extent<field_type>::value == N;
+            }
+
+            template <std::size_t I>
+            constexpr __host__ __device__ inline auto eval(
+                std::size_t k) const noexcept
+                -> decltype(tuple_field_at(
+                    hpx::get<I>(std::declval<Tuple const&>()), k))
+            {
+                return tuple_field_at(hpx::get<I>(t), k);
+            }
+
+            Tuple const& t;
+        };
+
+        template <typename T>
+        struct tuple_expr_scalar
+        {
+            static constexpr std::size_t size = 0;
+
+            template <std::size_t I, std::size_t N>
+            static constexpr bool fits() noexcept
+            {
+                return true;
+            }
+
+            template <std::size_t I>
+            constexpr __host__ __device__ inline T eval(
+                std::size_t /*k*/) const noexcept
+            {
+                return value;
+            }
+
+            T value;
+        };
+
+        template <typename Op, typename L, typename R>
+        struct tuple_expr_binary
+        {
+            static_assert(L::size == 0 || R::size == 0 || L::size == R::size,
+                "the operands of a tuple expression must have the same size");
+
+            static constexpr std::size_t size =
+                L::size != 0 ? L::size : R::size;
+
+            template <std::size_t I, std::size_t N>
+            static constexpr bool fits() noexcept
+            {
+                return L::template fits<I, N>() && R::template fits<I, N>();
+            }
+
+            template <std::size_t I>
+            constexpr __host__ __device__ inline auto eval(std::size_t k) const
+                -> decltype(Op::call(std::declval<L const&>().template eval<I>(k),
+                    std::declval<R const&>().template eval<I>(k)))
+            {
+                return Op::call(
+                    lhs.template eval<I>(k), rhs.template eval<I>(k));
+            }
+
+            L lhs;
+            R rhs;
+        };
+
+        struct tuple_expr_plus
+        {
+            template <typename T, typename U>
+            static constexpr __host__ __device__ inline auto call(
+                T const& t, U const& u) -> decltype(t + u)
+            {
+                return t + u;
+            }
+        };
+
+        struct tuple_expr_minus
+        {
+            template <typename T, typename U>
+            static constexpr __host__ __device__ inline auto call(
+                T const& t, U const& u) -> decltype(t - u)
+            {
+                return t - u;
+            }
+        };
+
+        struct tuple_expr_multiplies
+        {
+            template <typename T, typename U>
+            static constexpr __host__ __device__ inline auto call(
+                T const& t, U const& u) -> decltype(t * u)
+            {
+                return t * u;
+            }
+        };
+
+        struct tuple_expr_divides
+        {
+            template <typename T, typename U>
+            static constexpr __host__ __device__ inline auto call(
+                T const& t, U const& u) -> decltype(t / u)
+            {
+                return t / u;
+            }
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Turns an operand of an arithmetic operator into an expression node:
+        // nodes are kept by value, tuples are referenced, scalars are copied.
+        template <typename T, typename Enable = void>
+        struct tuple_expr_operand
+        {
+        };
+
+        template <typename Tuple>
+        struct tuple_expr_operand<Tuple,
+            typename std::enable_if<is_arithmetic_tuple<Tuple>::value>::type>
+        {
+            using type = tuple_expr_terminal<Tuple>;
+
+            static constexpr __host__ __device__ inline type call(
+                Tuple const& t) noexcept
+            {
+                return type{t};
+            }
+        };
+
+        template <typename T>
+        struct tuple_expr_operand<T,
+            typename std::enable_if<std::is_arithmetic<T>::value>::type>
+        {
+            using type = tuple_expr_scalar<T>;
+
+            static constexpr __host__ __device__ inline type call(
+                T const& t) noexcept
+            {
+                return type{t};
+            }
+        };
+
+        template <typename Op, typename L, typename R>
+        struct tuple_expr_operand<tuple_expr_binary<Op, L, R>>
+        {
+            using type = tuple_expr_binary<Op, L, R>;
+
+            static constexpr __host__ __device__ inline type const& call(
+                type const& t) noexcept
+            {
+                return t;
+            }
+        };
+
+        template <typename T>
+        struct is_tuple_expr_node : std::false_type
+        {
+        };
+
+        template <typename Op, typename L, typename R>
+        struct is_tuple_expr_node<tuple_expr_binary<Op, L, R>> : std::true_type
+        {
+        };
+
+        // At least one side has to be a tuple or an expression, scalars alone
+        // must not pick up these operators.
+        template <typename T, typename U>
+        struct is_tuple_expr_operands
+          : std::integral_constant<bool,
+                is_arithmetic_tuple<T>::value || is_tuple_expr_node<T>::value ||
+                    is_arithmetic_tuple<U>::value ||
+                    is_tuple_expr_node<U>::value>
+        {
+        };
+
+        template <typename Op, typename T, typename U>
+        using tuple_expr_result_t =
+            tuple_expr_binary<Op, typename tuple_expr_operand<T>::type,
+                typename tuple_expr_operand<U>::type>;
+
+        template <typename Op, typename T, typename U>
+        constexpr __host__ __device__ inline tuple_expr_result_t<Op, T, U>
+        make_tuple_expr(T const& t, U const& u) noexcept
+        {
+            return tuple_expr_result_t<Op, T, U>{
+                tuple_expr_operand<T>::call(t), tuple_expr_operand<U>::call(u)};
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <std::size_t I, typename Tuple, typename Expr>
+        __host__ __device__ inline void tuple_assign_element(
+            Tuple& dest, Expr const& expr)
+        {
+            using field_type =
+                typename std::decay<typename tuple_element<I, Tuple>::type>::type;
+            static_assert(Expr::template fits<I,
+                              tuple_field_extent<field_type>::value>(),
+                "the array operands of a tuple expression must have the same "
+                "extent as the destination element");
+
+            auto& field = hpx::get<I>(dest);
+            for (std::size_t k = 0; k != tuple_field_extent<field_type>::value;
+                 ++k)
+            {
+                tuple_field_at(field, k) = expr.template eval<I>(k);
+            }
+        }
+
+        template <std::size_t... Is, typename Tuple, typename Expr>
+        __host__ __device__ inline void tuple_assign_impl(
+            util::index_pack<Is...>, Tuple& dest, Expr const& expr)
+        {
+            (tuple_assign_element<Is>(dest, expr), ...);
+        }
+    }    // namespace detail
+
+    // Element-wise operators; each of them returns an unevaluated expression
+    // referring to its tuple operands, which therefore have to outlive it.
+    template <typename T, typename U>
+    constexpr __host__ __device__ inline
+        typename std::enable_if<detail::is_tuple_expr_operands<T, U>::value,
+            detail::tuple_expr_result_t<detail::tuple_expr_plus, T, U>>::type
+        operator+(T const& t, U const& u) noexcept
+    {
+        return detail::make_tuple_expr<detail::tuple_expr_plus>(t, u);
+    }
+
+    template <typename T, typename U>
+    constexpr __host__ __device__ inline
+        typename std::enable_if<detail::is_tuple_expr_operands<T, U>::value,
+            detail::tuple_expr_result_t<detail::tuple_expr_minus, T, U>>::type
+        operator-(T const& t, U const& u) noexcept
+    {
+        return detail::make_tuple_expr<detail::tuple_expr_minus>(t, u);
+    }
+
+    template <typename T, typename U>
+    constexpr __host__ __device__ inline
+        typename std::enable_if<detail::is_tuple_expr_operands<T, U>::value,
+            detail::tuple_expr_result_t<detail::tuple_expr_multiplies, T,
+                U>>::type
+        operator*(T const& t, U const& u) noexcept
+    {
+        return detail::make_tuple_expr<detail::tuple_expr_multiplies>(t, u);
+    }
+
+    template <typename T, typename U>
+    constexpr __host__ __device__ inline
+        typename std::enable_if<detail::is_tuple_expr_operands<T, U>::value,
+            detail::tuple_expr_result_t<detail::tuple_expr_divides, T, U>>::type
+        operator/(T const& t, U const& u) noexcept
+    {
+        return detail::make_tuple_expr<detail::tuple_expr_divides>(t, u);
+    }
+
+    // Evaluates expr element-wise into dest. The destination may appear in the
+    // expression itself (e.g. tuple_assign(a, a + b)) as every scalar is read
+    // before the corresponding scalar of dest is written.
+    template <typename Tuple, typename Expr>
+    __host__ __device__ inline Tuple& tuple_assign(Tuple& dest, Expr const& expr)
+    {
+        using expr_type = typename detail::tuple_expr_operand<Expr>::type;
+        static_assert(expr_type::size == 0 ||
+                expr_type::size == tuple_size<Tuple>::value,
+            "the expression must have the same size as the destination tuple");
+
+        detail::tuple_assign_impl(
+            typename util::make_index_pack<tuple_size<Tuple>::value>::type{},
+            dest, detail::tuple_expr_operand<Expr>::call(expr));
+        return dest;
+    }
+
+    // y = a * x + y, evaluated in a single fused pass
+    template <typename T, typename Tuple, typename XTuple>
+    __host__ __device__ inline Tuple& tuple_axpy(
+        T const& a, XTuple const& x, Tuple& y)
+    {
+        return tuple_assign(y, a * x + y);
+    }
+}    // namespace hpx
@@ -0,0 +1,112 @@
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "try_tuple.hpp"
+
+#include <cstddef>    // for size_t
+#include <cstdint>
+#include <functional>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace hpx {
+
+    namespace detail {
+
+        // Elements are hashed by their decayed type, except for anything
+        // convertible to a std::string_view (std::string, char const*, string
+        // literals), which is hashed as such. This way tuples holding owning
+        // strings hash the same as tuples referring to views of them, which is
+        // what heterogeneous lookup relies on.
+        template <typename T, typename Enable = void>
+        struct tuple_hash_element
+        {
+            static std::size_t call(T const& t)
+            {
+                return std::hash<T>()(t);
+            }
+        };
+
+        template <typename T>
+        struct tuple_hash_element<T,
+            typename std::enable_if<
+                std::is_convertible<T const&, std::string_view>::value>::type>
+        {
+            static std::size_t call(T const& t)
+            {
+                return std::hash<std::string_view>()(std::string_view(t));
+            }
+        };
+
+        inline std::size_t tuple_hash_combine(
+            std::size_t seed, std::size_t value) noexcept
+        {
+            return seed ^
+                (value + std::size_t(0x9e3779b97f4a7c15ull) + (seed << 6) +
+                    (seed >> 2));
+        }
+
+        // The element hashes of integral types are usually the identity,
+        // tables deriving several indices from one hash scramble its bits
+        // first.
+        inline std::uint64_t tuple_hash_mix(std::uint64_t h) noexcept
+        {
+            h ^= h >> 33;
+            h *= 0xff51afd7ed558ccdull;
+            h ^= h >> 33;
+            h *= 0xc4ceb9fe1a85ec53ull;
+            h ^= h >> 33;
+            return h;
+        }
+
+        template <std::size_t... Is, typename Tuple>
+        inline std::size_t tuple_hash_impl(
+            util::index_pack<Is...>, Tuple const& t)
+        {
+            std::size_t seed = 0;
+            ((seed = tuple_hash_combine(seed,
+                  tuple_hash_element<typename std::decay<
+                      typename tuple_element<Is, Tuple>::type>::type>::
+                      call(hpx::get<Is>(t)))),
+                ...);
+            return seed;
+        }
+    }    // namespace detail
+
+    // Hashes any tuple-like type element by element. The functor is
+    // transparent: tuples which compare equal using operator== hash to the
+    // same value if their elements have the same decayed types, or are
+    // strings (anything convertible to std::string_view) where the types
+    // differ, e.g. tuple<std::string> and the result of
+    // forward_as_tuple("key"). Numerically equal values of different
+    // arithmetic types, e.g. 1 and 1.0, hash differently.
+    struct tuple_hash
+    {
+        using is_transparent = void;
+
+        template <typename Tuple>
+        std::size_t operator()(Tuple const& t) const
+        {
+            return detail::tuple_hash_impl(
+                typename util::make_index_pack<tuple_size<Tuple>::value>::type{},
+                t);
+        }
+    };
+
+    // Transparent equality for tuples, forwarding to the relational operators
+    // which already accept mismatched tuple<Ts...>/tuple<Us...>.
+    struct tuple_equal
+    {
+        using is_transparent = void;
+
+        template <typename TTuple, typename UTuple>
+        bool operator()(TTuple const& t, UTuple const& u) const
+        {
+            return t == u;
+        }
+    };
+}    // namespace hpx
@@ -0,0 +1,264 @@
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Opt-in instrumentation of the tuple machinery. When compiled with
+// HPX_TUPLE_HAVE_INSTRUMENTATION defined, constructions, copies, moves and
+// assignments of tuples as well as calls to tuple_cat, forward_as_tuple, tie
+// and the rvalue overloads of get are counted per call site and tuple type.
+// Counts are collected in a thread-local registry which is merged into a
+// global one when the thread exits; the global registry is printed as a table
+// to stderr at program exit (or explicitly using
+// hpx::dump_tuple_instrumentation).
+//
+// The call site is passed by a trailing default argument evaluating
+// __builtin_FILE() and __builtin_LINE(), which is added to the default,
+// element-wise, converting, copy and move constructors and to the rvalue
+// overloads of get. A parameter pack can not be followed by such an
+// argument, the forwarding constructor, tuple_cat, forward_as_tuple and tie
+// are therefore overloaded for up to four arguments in instrumented builds;
+// calls with more arguments are attributed to the line inside of this
+// library recording them. Operators can not have default arguments either,
+// assignments are always attributed to the library.
+//
+// The copy and move constructors of tuple are user-provided in instrumented
+// builds, tuples are then not trivially copyable (and not usable with
+// atomic_tuple).
+//
+// Without HPX_TUPLE_HAVE_INSTRUMENTATION the hooks expand to nothing. Events
+// happening during constant evaluation or in device code are never counted.
+
+#pragma once
+
+#if defined(HPX_TUPLE_HAVE_INSTRUMENTATION)
+
+#include <array>
+#include <cstddef>    // for size_t
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <string>
+#include <map>
+#include <typeinfo>
+#include <utility>
+
+#if defined(__GNUC__)
+#include <cxxabi.h>
+#endif
+
+#include <hip/hip_runtime.h>
+
+namespace hpx {
+
+    namespace detail {
+
+        enum class tuple_event : std::size_t
+        {
+            construct,
+            convert,
+            copy,
+            move,
+            copy_assign,
+            move_assign,
+            tuple_cat,
+            forward_as_tuple,
+            tie,
+            rvalue_get,
+            num_events
+        };
+
+        inline char const* const* tuple_event_names() noexcept
+        {
+            static char const* const names[] = {"construct", "convert", "copy",
+                "move", "copy=", "move=", "tuple_cat", "forward_as_tuple",
+                "tie", "get&&"};
+            return names;
+        }
+
+        // The location a tuple operation was invoked from.
+        struct tuple_call_site
+        {
+            // used as a default argument, this yields the location of the
+            // caller
+            static constexpr __host__ __device__ tuple_call_site current(
+                char const* file = __builtin_FILE(),
+                unsigned line = __builtin_LINE()) noexcept
+            {
+                return tuple_call_site{file, line};
+            }
+
+            char const* file;
+            unsigned line;
+        };
+
+        using tuple_event_counts = std::array<std::size_t,
+            static_cast<std::size_t>(tuple_event::num_events)>;
+
+        // keyed by the call site ("file:line") and the (mangled) name of the
+        // tuple type, ordered by call site
+        using tuple_event_key = std::pair<std::string, std::string>;
+        using tuple_event_table = std::map<tuple_event_key, tuple_event_counts>;
+
+        inline void tuple_event_merge(
+            tuple_event_table& dest, tuple_event_table const& src)
+        {
+            for (auto const& entry : src)
+            {
+                tuple_event_counts& counts = dest[entry.first];
+                for (std::size_t i = 0; i != counts.size(); ++i)
+                    counts[i] += entry.second[i];
+            }
+        }
+
+        inline std::string tuple_event_demangle(std::string const& name)
+        {
+#if defined(__GNUC__)
+            int status = 0;
+            char* demangled =
+                abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
+            if (status == 0 && demangled != nullptr)
+            {
+                std::string result(demangled);
+                std::free(demangled);
+                return result;
+            }
+#endif
+            return name;
+        }
+
+        inline void tuple_event_print(
+            std::FILE* out, tuple_event_table const& table)
+        {
+            if (table.empty())
+                return;
+
+            char const* const* names = tuple_event_names();
+            std::fprintf(out, "tuple instrumentation:\n");
+            for (std::size_t i = 0;
+                 i != static_cast<std::size_t>(tuple_event::num_events); ++i)
+            {
+                std::fprintf(out, "%12s ", names[i]);
+            }
+            std::fprintf(out, " call site, type\n");
+
+            for (auto const& entry : table)
+            {
+                for (std::size_t count : entry.second)
+                    std::fprintf(out, "%12zu ", count);
+                std::fprintf(out, " %s, %s\n", entry.first.first.c_str(),
+                    tuple_event_demangle(entry.first.second).c_str());
+            }
+        }
+
+        struct tuple_event_global_registry
+        {
+            ~tuple_event_global_registry()
+            {
+                tuple_event_print(stderr, table);
+            }
+
+            std::mutex mtx;
+            tuple_event_table table;
+        };
+
+        inline tuple_event_global_registry& tuple_event_global() noexcept
+        {
+            static tuple_event_global_registry registry;
+            return registry;
+        }
+
+        struct tuple_event_local_registry
+        {
+            tuple_event_local_registry()
+            {
+                // make sure the global registry outlives all local ones
+                tuple_event_global();
+            }
+
+            ~tuple_event_local_registry()
+            {
+                flush();
+            }
+
+            void flush()
+            {
+                tuple_event_global_registry& global = tuple_event_global();
+                std::lock_guard<std::mutex> l(global.mtx);
+                tuple_event_merge(global.table, table);
+                table.clear();
+            }
+
+            tuple_event_table table;
+        };
+
+        inline tuple_event_local_registry& tuple_event_local() noexcept
+        {
+            static thread_local tuple_event_local_registry registry;
+            return registry;
+        }
+
+        template <typename Tuple>
+        void tuple_instrument(tuple_event event, tuple_call_site site) noexcept
+        {
+            try
+            {
+                tuple_event_key key(
+                    std::string(site.file) + ':' + std::to_string(site.line),
+                    typeid(Tuple).name());
+                ++tuple_event_local()
+                      .table[std::move(key)][static_cast<std::size_t>(event)];
+            }
+            catch (...)
+            {
+                // losing a count is preferable to terminating
+            }
+        }
+    }    // namespace detail
+
+    // Merges the counts of the calling thread into the global registry and
+    // prints the global registry.
+    inline void dump_tuple_instrumentation(std::FILE* out = stderr)
+    {
+        detail::tuple_event_local().flush();
+
+        detail::tuple_event_global_registry& global =
+            detail::tuple_event_global();
+        std::lock_guard<std::mutex> l(global.mtx);
+        detail::tuple_event_print(out, global.table);
+    }
+}    // namespace hpx
+
+// Declares the trailing parameter receiving the call site, the _REDECL
+// variant is used for the definitions of functions declared before.
+#define HPX_TUPLE_CALL_SITE                                                    \
+    , ::hpx::detail::tuple_call_site site =                                    \
+          ::hpx::detail::tuple_call_site::current()
+#define HPX_TUPLE_CALL_SITE_REDECL , ::hpx::detail::tuple_call_site site
+
+#if defined(__HIP_DEVICE_COMPILE__)
+#define HPX_TUPLE_INSTRUMENT(event, ...) ((void) 0)
+#define HPX_TUPLE_INSTRUMENT_CALL_SITE(event, ...) ((void) site)
+#else
+// counts an event at the call site passed by HPX_TUPLE_CALL_SITE
+#define HPX_TUPLE_INSTRUMENT_CALL_SITE(event, ...)                             \
+    (__builtin_is_constant_evaluated() ?                                       \
+            (void) site :                                                      \
+            ::hpx::detail::tuple_instrument<__VA_ARGS__>(                      \
+                ::hpx::detail::tuple_event::event, site))
+// counts an event at the line recording it
+#define HPX_TUPLE_INSTRUMENT(event, ...)                                       \
+    (__builtin_is_constant_evaluated() ?                                       \
+            (void) 0 :                                                         \
+            ::hpx::detail::tuple_instrument<__VA_ARGS__>(                      \
+                ::hpx::detail::tuple_event::event,                             \
+                ::hpx::detail::tuple_call_site{__FILE__, __LINE__}))
+#endif
+
+#else
+
+#define HPX_TUPLE_CALL_SITE
+#define HPX_TUPLE_CALL_SITE_REDECL
+#define HPX_TUPLE_INSTRUMENT(event, ...) ((void) 0)
+#define HPX_TUPLE_INSTRUMENT_CALL_SITE(event, ...) ((void) 0)
+
+#endif
@@ -0,0 +1,405 @@
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// tuple_interner<Ts...> stores a single copy of each distinct tuple value
+// (hash consing) and hands out interned_tuple handles referring to it. Two
+// handles obtained from the same interner compare equal if and only if the
+// tuples compare equal, which turns the comparison (and hashing) of repeated
+// composite keys into a pointer comparison.
+//
+// The values live in an arena of geometrically growing blocks which are never
+// moved or freed before the interner is destroyed, so handles stay valid for
+// the lifetime of the interner. Lookup uses tuple_hash and tuple_equal, so
+// any tuple whose elements have the decayed types of Ts... (or are strings
+// where Ts... holds strings) can be interned, e.g. the result of
+// forward_as_tuple(id, name_view). It is only copied if its value was not
+// seen before. Other arithmetic types may hash differently and are then
+// interned as different values: a tuple_interner<double> interns
+// forward_as_tuple(1) separately from tuple<double>(1.0), unless it is
+// converted to tuple<double> first.
+// sharded_tuple_interner can be used concurrently from many threads.
+
+#pragma once
+
+#include "try_tuple.hpp"
+#include "tuple_hash.hpp"
+
+#include <algorithm>
+#include <cstddef>    // for size_t
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <shared_mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx {
+
+    template <typename... Ts>
+    class tuple_interner;
+
+    template <typename... Ts>
+    class sharded_tuple_interner;
+
+    namespace detail {
+
+        // Allocates objects of type T from blocks which are never moved, so
+        // that the objects keep their address until the arena is destroyed.
+        template <typename T>
+        class bump_arena
+        {
+            struct alignas(T) storage
+            {
+                unsigned char data[sizeof(T)];
+            };
+
+            struct block
+            {
+                std::unique_ptr<storage[]> data;
+                std::size_t size;
+                std::size_t capacity;
+            };
+
+        public:
+            explicit bump_arena(std::size_t initial_block_size = 64)
+              : _next_block_size((std::max)(initial_block_size, std::size_t(1)))
+            {
+            }
+
+            bump_arena(bump_arena const&) = delete;
+            bump_arena& operator=(bump_arena const&) = delete;
+
+            ~bump_arena()
+            {
+                if constexpr (!std::is_trivially_destructible<T>::value)
+                {
+                    for (block& b : _blocks)
+                    {
+                        for (std::size_t i = 0; i != b.size; ++i)
+                        {
+                            std::launder(reinterpret_cast<T*>(&b.data[i]))
+                                ->~T();
+                        }
+                    }
+                }
+            }
+
+            template <typename... Args>
+            T* emplace(Args&&... args)
+            {
+                if (_blocks.empty() ||
+                    _blocks.back().size == _blocks.back().capacity)
+                {
+                    // limit the growth to keep the unused tail small
+                    std::size_t const max_block_size = 64 * 1024;
+
+                    _blocks.push_back(block{
+                        std::unique_ptr<storage[]>(
+                            new storage[_next_block_size]),
+                        0, _next_block_size});
+                    _next_block_size =
+                        (std::min)(_next_block_size * 2, max_block_size);
+                }
+
+                block& b = _blocks.back();
+                T* p = ::new (static_cast<void*>(&b.data[b.size]))
+                    T(std::forward<Args>(args)...);
+                ++b.size;
+                return p;
+            }
+
+        private:
+            std::vector<block> _blocks;
+            std::size_t _next_block_size;
+        };
+    }    // namespace detail
+
+    // Refers to a tuple stored by a tuple_interner. Default constructed
+    // handles refer to no tuple and compare equal to each other.
+    template <typename... Ts>
+    class interned_tuple
+    {
+    public:
+        using value_type = tuple<Ts...>;
+
+        constexpr interned_tuple() noexcept
+          : _value(nullptr)
+        {
+        }
+
+        value_type const& get() const noexcept
+        {
+            return *_value;
+        }
+
+        value_type const& operator*() const noexcept
+        {
+            return *_value;
+        }
+
+        value_type const* operator->() const noexcept
+        {
+            return _value;
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return _value != nullptr;
+        }
+
+        friend bool operator==(
+            interned_tuple const& lhs, interned_tuple const& rhs) noexcept
+        {
+            return lhs._value == rhs._value;
+        }
+
+        friend bool operator!=(
+            interned_tuple const& lhs, interned_tuple const& rhs) noexcept
+        {
+            return lhs._value != rhs._value;
+        }
+
+    private:
+        friend class tuple_interner<Ts...>;
+
+        explicit interned_tuple(value_type const* value) noexcept
+          : _value(value)
+        {
+        }
+
+        value_type const* _value;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Interns tuples, not thread-safe.
+    template <typename... Ts>
+    class tuple_interner
+    {
+    public:
+        using value_type = tuple<Ts...>;
+        using handle = interned_tuple<Ts...>;
+
+    private:
+        struct slot
+        {
+            std::uint64_t hash;
+            value_type const* value;    // nullptr for empty slots
+        };
+
+        template <typename Tuple>
+        static std::uint64_t hash_of(Tuple const& t)
+        {
+            return detail::tuple_hash_mix(
+                static_cast<std::uint64_t>(tuple_hash()(t)));
+        }
+
+        // Returns the position of the slot holding t, or the position of the
+        // empty slot terminating the probe sequence.
+        template <typename Tuple>
+        std::size_t probe(std::uint64_t hash, Tuple const& t) const
+        {
+            std::size_t const mask = _slots.size() - 1;
+            std::size_t pos = static_cast<std::size_t>(hash) & mask;
+            while (_slots[pos].value &&
+                !(_slots[pos].hash == hash &&
+                    tuple_equal()(*_slots[pos].value, t)))
+            {
+                pos = (pos + 1) & mask;
+            }
+            return pos;
+        }
+
+        void grow()
+        {
+            std::vector<slot> slots(_slots.size() * 2, slot{0, nullptr});
+            std::size_t const mask = slots.size() - 1;
+            for (slot const& s : _slots)
+            {
+                if (!s.value)
+                    continue;
+
+                std::size_t pos = static_cast<std::size_t>(s.hash) & mask;
+                while (slots[pos].value)
+                    pos = (pos + 1) & mask;
+                slots[pos] = s;
+            }
+            _slots = std::move(slots);
+        }
+
+        template <typename Tuple>
+        handle find_hashed(std::uint64_t hash, Tuple const& t) const
+        {
+            return handle(_slots[probe(hash, t)].value);
+        }
+
+        template <typename Tuple>
+        handle intern_hashed(std::uint64_t hash, Tuple const& t)
+        {
+            std::size_t pos = probe(hash, t);
+            if (_slots[pos].value)
+                return handle(_slots[pos].value);
+
+            // keep the load factor at or below 1/2
+            if (2 * (_count + 1) > _slots.size())
+            {
+                grow();
+                pos = probe(hash, t);
+            }
+
+            value_type const* value = _arena.emplace(t);
+            _slots[pos] = slot{hash, value};
+            ++_count;
+            return handle(value);
+        }
+
+        friend class sharded_tuple_interner<Ts...>;
+
+    public:
+        explicit tuple_interner(std::size_t initial_capacity = 16)
+          : _count(0)
+        {
+            std::size_t capacity = 2;
+            while (capacity < 2 * initial_capacity)
+                capacity *= 2;
+            _slots.resize(capacity, slot{0, nullptr});
+        }
+
+        tuple_interner(tuple_interner const&) = delete;
+        tuple_interner& operator=(tuple_interner const&) = delete;
+
+        // Returns the handle of the stored tuple equal to t, storing a copy
+        // of t first if there is none.
+        template <typename Tuple>
+        handle intern(Tuple const& t)
+        {
+            return intern_hashed(hash_of(t), t);
+        }
+
+        // Returns the handle of the stored tuple equal to t, or an empty
+        // handle if there is none.
+        template <typename Tuple>
+        handle find(Tuple const& t) const
+        {
+            return find_hashed(hash_of(t), t);
+        }
+
+        // the number of distinct tuples stored
+        std::size_t size() const noexcept
+        {
+            return _count;
+        }
+
+    private:
+        std::vector<slot> _slots;
+        std::size_t _count;
+        detail::bump_arena<value_type> _arena;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Interns tuples concurrently. The tuples are distributed over shards by
+    // their hash, each shard is a tuple_interner guarded by its own
+    // reader/writer lock. Tuples which were interned before are found while
+    // holding the lock for reading only.
+    template <typename... Ts>
+    class sharded_tuple_interner
+    {
+    public:
+        using value_type = tuple<Ts...>;
+        using handle = interned_tuple<Ts...>;
+
+    private:
+        // shards are aligned to avoid false sharing between their locks
+        struct alignas(64) shard
+        {
+            explicit shard(std::size_t initial_capacity)
+              : interner(initial_capacity)
+            {
+            }
+
+            mutable std::shared_mutex mtx;
+            tuple_interner<Ts...> interner;
+        };
+
+        shard& shard_of(std::uint64_t hash) const noexcept
+        {
+            return *_shards[(hash >> 32) & (_shards.size() - 1)];
+        }
+
+    public:
+        // The number of shards is rounded up to a power of two.
+        explicit sharded_tuple_interner(std::size_t num_shards = 64,
+            std::size_t initial_shard_capacity = 16)
+        {
+            std::size_t n = 1;
+            while (n < num_shards)
+                n *= 2;
+
+            _shards.reserve(n);
+            for (std::size_t i = 0; i != n; ++i)
+                _shards.emplace_back(new shard(initial_shard_capacity));
+        }
+
+        sharded_tuple_interner(sharded_tuple_interner const&) = delete;
+        sharded_tuple_interner& operator=(
+            sharded_tuple_interner const&) = delete;
+
+        template <typename Tuple>
+        handle intern(Tuple const& t)
+        {
+            std::uint64_t const hash = tuple_interner<Ts...>::hash_of(t);
+            shard& s = shard_of(hash);
+            {
+                std::shared_lock<std::shared_mutex> l(s.mtx);
+                handle h = s.interner.find_hashed(hash, t);
+                if (h)
+                    return h;
+            }
+
+            std::unique_lock<std::shared_mutex> l(s.mtx);
+            return s.interner.intern_hashed(hash, t);
+        }
+
+        template <typename Tuple>
+        handle find(Tuple const& t) const
+        {
+            std::uint64_t const hash = tuple_interner<Ts...>::hash_of(t);
+            shard const& s = shard_of(hash);
+
+            std::shared_lock<std::shared_mutex> l(s.mtx);
+            return s.interner.find_hashed(hash, t);
+        }
+
+        // The result is only a snapshot while other threads intern tuples.
+        std::size_t size() const
+        {
+            std::size_t result = 0;
+            for (auto const& s : _shards)
+            {
+                std::shared_lock<std::shared_mutex> l(s->mtx);
+                result += s->interner.size();
+            }
+            return result;
+        }
+
+    private:
+        std::vector<std::unique_ptr<shard>> _shards;
+    };
+}    // namespace hpx
+
+namespace std {
+
+    template <typename... Ts>
+    struct hash<hpx::interned_tuple<Ts...>>
+    {
+        std::size_t operator()(
+            hpx::interned_tuple<Ts...> const& h) const noexcept
+        {
+            return std::hash<hpx::tuple<Ts...> const*>()(
+                h ? &h.get() : nullptr);
+        }
+    };
+}    // namespace std
@@ -0,0 +1,401 @@
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Reading and writing tuples as delimiter separated lines of text. The
+// conversion of each column is derived from the corresponding tuple_element:
+// integral and floating point elements are converted using std::from_chars
+// and std::to_chars, bools are written as 0 and 1, std::string_view elements
+// refer to the text itself and std::string elements copy it. Fields are not
+// quoted, a field can therefore not contain the delimiter.
+//
+// tuple_record_reader reads lines from a stream into a rolling buffer which
+// is reused for all lines, parsing a line does not allocate (unless the
+// tuple holds std::string's). for_each_tuple_record parses text which is
+// already in memory, optionally splitting it into chunks at line boundaries
+// which are parsed by separate threads.
+
+#pragma once
+
+#include "try_tuple.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>    // for size_t
+#include <exception>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx {
+
+    namespace detail {
+
+        template <typename T>
+        bool parse_tuple_field(std::string_view field, T& value)
+        {
+            if constexpr (std::is_same<T, bool>::value)
+            {
+                if (field == "1" || field == "true")
+                    value = true;
+                else if (field == "0" || field == "false")
+                    value = false;
+                else
+                    return false;
+                return true;
+            }
+            else if constexpr (std::is_arithmetic<T>::value)
+            {
+                char const* last = field.data() + field.size();
+                auto result = std::from_chars(field.data(), last, value);
+                return result.ec == std::errc() && result.ptr == last;
+            }
+            else
+            {
+                static_assert(std::is_assignable<T&, std::string_view>::value,
+                    "tuple elements have to be arithmetic types or be "
+                    "assignable from a std::string_view");
+                value = field;
+                return true;
+            }
+        }
+
+        template <std::size_t... Is, typename Tuple>
+        bool parse_tuple_record_impl(util::index_pack<Is...>,
+            std::string_view line, Tuple& record, char delimiter)
+        {
+            constexpr std::size_t last = sizeof...(Is) - 1;
+
+            std::size_t pos = 0;
+            auto parse_next = [&](auto& value, bool is_last) {
+                // the last field extends to the end of the line, it must not
+                // be followed by another delimiter
+                std::size_t const end = line.find(delimiter, pos);
+                if (is_last != (end == std::string_view::npos))
+                    return false;
+
+                std::size_t const size =
+                    is_last ? line.size() - pos : end - pos;
+                bool const ok =
+                    parse_tuple_field(line.substr(pos, size), value);
+                pos = end + 1;
+                return ok;
+            };
+
+            return (parse_next(hpx::get<Is>(record), Is == last) && ...);
+        }
+
+        template <typename T>
+        void format_tuple_field(std::string& out, T const& value)
+        {
+            if constexpr (std::is_same<T, bool>::value)
+            {
+                out.push_back(value ? '1' : '0');
+            }
+            else if constexpr (std::is_arithmetic<T>::value)
+            {
+                // large enough for any integral or floating point value
+                char buffer[64];
+                auto result =
+                    std::to_chars(buffer, buffer + sizeof(buffer), value);
+                out.append(buffer, result.ptr);
+            }
+            else
+            {
+                out.append(std::string_view(value));
+            }
+        }
+
+        template <std::size_t... Is, typename Tuple>
+        void format_tuple_record_impl(util::index_pack<Is...>,
+            std::string& out, Tuple const& record, char delimiter)
+        {
+            ((Is != 0 ? out.push_back(delimiter) : void(),
+                 format_tuple_field(out, hpx::get<Is>(record))),
+                ...);
+        }
+    }    // namespace detail
+
+    // Parses the delimiter separated fields of line into the elements of
+    // record. Returns false if the number of fields does not match the size
+    // of the tuple or if a field could not be converted, in which case the
+    // contents of record are unspecified.
+    template <typename Tuple>
+    bool parse_tuple_record(
+        std::string_view line, Tuple& record, char delimiter = ',')
+    {
+        static_assert(tuple_size<Tuple>::value != 0,
+            "records have to have at least one field");
+
+        return detail::parse_tuple_record_impl(
+            typename util::make_index_pack<tuple_size<Tuple>::value>::type{},
+            line, record, delimiter);
+    }
+
+    // Appends the elements of record to out, separated by delimiter. No line
+    // terminator is appended.
+    template <typename Tuple>
+    void format_tuple_record(
+        std::string& out, Tuple const& record, char delimiter = ',')
+    {
+        detail::format_tuple_record_impl(
+            typename util::make_index_pack<tuple_size<Tuple>::value>::type{},
+            out, record, delimiter);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Reads one record per line from a stream. Empty lines are skipped, a
+    // trailing '\r' is removed from every line.
+    template <typename Tuple>
+    class tuple_record_reader
+    {
+    public:
+        explicit tuple_record_reader(std::istream& in, char delimiter = ',',
+            std::size_t buffer_size = 64 * 1024)
+          : _in(in)
+          , _delimiter(delimiter)
+          , _buffer((std::max)(buffer_size, std::size_t(1)))
+          , _begin(0)
+          , _end(0)
+          , _line_number(0)
+        {
+        }
+
+        tuple_record_reader(tuple_record_reader const&) = delete;
+        tuple_record_reader& operator=(tuple_record_reader const&) = delete;
+
+        // Parses the next line into record. Returns false at the end of the
+        // input. Elements of type std::string_view refer to the internal
+        // buffer and are valid until the next call. Throws
+        // std::invalid_argument if a line can not be parsed.
+        bool next(Tuple& record)
+        {
+            std::string_view line;
+            do
+            {
+                if (!next_line(line))
+                    return false;
+            } while (line.empty());
+
+            if (!parse_tuple_record(line, record, _delimiter))
+            {
+                throw std::invalid_argument(
+                    "tuple_record_reader: malformed record in line " +
+                    std::to_string(_line_number));
+            }
+            return true;
+        }
+
+        // the number of the line last read, starting at one
+        std::size_t line_number() const noexcept
+        {
+            return _line_number;
+        }
+
+    private:
+        bool next_line(std::string_view& line)
+        {
+            std::size_t scanned = _begin;
+            for (;;)
+            {
+                char const* data = _buffer.data();
+                char const* nl = std::find(data + scanned, data + _end, '\n');
+                if (nl != data + _end)
+                {
+                    return make_line(
+                        line, static_cast<std::size_t>(nl - data), 1);
+                }
+
+                scanned = _end;
+                if (!fill(scanned))
+                {
+                    // the last line may lack its terminator
+                    if (_begin == _end)
+                        return false;
+                    return make_line(line, _end, 0);
+                }
+            }
+        }
+
+        bool make_line(
+            std::string_view& line, std::size_t end, std::size_t terminator)
+        {
+            line = std::string_view(_buffer.data() + _begin, end - _begin);
+            if (!line.empty() && line.back() == '\r')
+                line.remove_suffix(1);
+
+            _begin = end + terminator;
+            ++_line_number;
+            return true;
+        }
+
+        // Moves the pending partial line to the front of the buffer (growing
+        // it if the line fills all of it) and reads more data. scanned is
+        // adjusted to the moved data.
+        bool fill(std::size_t& scanned)
+        {
+            if (!_in)
+                return false;
+
+            if (_begin != 0)
+            {
+                std::copy(_buffer.data() + _begin, _buffer.data() + _end,
+                    _buffer.data());
+                scanned -= _begin;
+                _end -= _begin;
+                _begin = 0;
+            }
+            if (_end == _buffer.size())
+                _buffer.resize(_buffer.size() * 2);
+
+            _in.read(_buffer.data() + _end,
+                static_cast<std::streamsize>(_buffer.size() - _end));
+            std::size_t const count = static_cast<std::size_t>(_in.gcount());
+            _end += count;
+            return count != 0;
+        }
+
+        std::istream& _in;
+        char _delimiter;
+        std::vector<char> _buffer;
+        std::size_t _begin;    // start of the unread data
+        std::size_t _end;      // end of the valid data
+        std::size_t _line_number;
+    };
+
+    // Writes one record per line to a stream, buffering the output.
+    class tuple_record_writer
+    {
+    public:
+        explicit tuple_record_writer(std::ostream& out, char delimiter = ',',
+            std::size_t buffer_size = 64 * 1024)
+          : _out(out)
+          , _delimiter(delimiter)
+          , _buffer_size(buffer_size)
+        {
+            _buffer.reserve(buffer_size + 256);
+        }
+
+        tuple_record_writer(tuple_record_writer const&) = delete;
+        tuple_record_writer& operator=(tuple_record_writer const&) = delete;
+
+        ~tuple_record_writer()
+        {
+            flush();
+        }
+
+        template <typename Tuple>
+        void write(Tuple const& record)
+        {
+            format_tuple_record(_buffer, record, _delimiter);
+            _buffer.push_back('\n');
+            if (_buffer.size() >= _buffer_size)
+                flush();
+        }
+
+        void flush()
+        {
+            _out.write(
+                _buffer.data(), static_cast<std::streamsize>(_buffer.size()));
+            _buffer.clear();
+        }
+
+    private:
+        std::ostream& _out;
+        char _delimiter;
+        std::size_t _buffer_size;
+        std::string _buffer;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Parses each non-empty line of text into a Tuple and calls f(record).
+    // With num_threads > 1 the text is split into chunks at line boundaries,
+    // each chunk is parsed by its own thread into its own Tuple and f is
+    // called concurrently. Throws std::invalid_argument if a line can not be
+    // parsed.
+    template <typename Tuple, typename F>
+    void for_each_tuple_record(std::string_view text, F&& f,
+        std::size_t num_threads = 1, char delimiter = ',')
+    {
+        auto parse_chunk = [&](std::string_view chunk) {
+            Tuple record;
+            while (!chunk.empty())
+            {
+                std::size_t const nl = chunk.find('\n');
+                std::string_view line = chunk.substr(0, nl);
+                chunk.remove_prefix(
+                    nl == std::string_view::npos ? chunk.size() : nl + 1);
+
+                if (!line.empty() && line.back() == '\r')
+                    line.remove_suffix(1);
+                if (line.empty())
+                    continue;
+
+                if (!parse_tuple_record(line, record, delimiter))
+                {
+                    throw std::invalid_argument(
+                        "for_each_tuple_record: malformed record");
+                }
+                f(static_cast<Tuple const&>(record));
+            }
+        };
+
+        // don't bother splitting small inputs
+        std::size_t const min_chunk = 64 * 1024;
+        num_threads = (std::min)(num_threads, text.size() / min_chunk);
+        if (num_threads <= 1)
+        {
+            parse_chunk(text);
+            return;
+        }
+
+        // chunks end after the first line terminator following an even split
+        std::vector<std::string_view> chunks;
+        chunks.reserve(num_threads);
+        std::size_t begin = 0;
+        for (std::size_t k = 1; k <= num_threads && begin < text.size(); ++k)
+        {
+            std::size_t end = text.size();
+            if (k != num_threads)
+            {
+                end = text.find('\n',
+                    (std::max)(begin, text.size() * k / num_threads));
+                end = end == std::string_view::npos ? text.size() : end + 1;
+            }
+            chunks.push_back(text.substr(begin, end - begin));
+            begin = end;
+        }
+
+        std::vector<std::thread> threads;
+        std::vector<std::exception_ptr> errors(chunks.size());
+        threads.reserve(chunks.size());
+        for (std::size_t k = 0; k != chunks.size(); ++k)
+        {
+            threads.emplace_back([&, k] {
+                try
+                {
+                    parse_chunk(chunks[k]);
+                }
+                catch (...)
+                {
+                    errors[k] = std::current_exception();
+                }
+            });
+        }
+        for (auto& t : threads)
+            t.join();
+
+        for (auto const& e : errors)
+        {
+            if (e)
+                std::rethrow_exception(e);
+        }
+    }
+}    // namespace hpx
@@ -0,0 +1,148 @@
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Sorting of records stored as a structure of arrays, i.e. as a tuple of
+// columns. Instead of materializing the rows, a permutation of the row
+// indices is sorted by comparing forward_as_tuple views of the key columns
+// only. The permutation is then applied to every column with a single gather
+// pass. The sort can optionally be split over several threads, each sorting
+// a contiguous part of the permutation, followed by rounds of pairwise merges.
+
+#pragma once
+
+#include "try_tuple.hpp"
+
+#include <algorithm>
+#include <cstddef>    // for size_t
+#include <numeric>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx {
+
+    namespace detail {
+
+        // Orders row indices by the key columns Is..., ties are broken by
+        // the index itself, which makes the resulting order stable.
+        template <typename SoA, std::size_t... Is>
+        struct columns_less
+        {
+            SoA& soa;
+
+            bool operator()(std::size_t lhs, std::size_t rhs) const
+            {
+                return hpx::forward_as_tuple(hpx::get<Is>(soa)[lhs]..., lhs) <
+                    hpx::forward_as_tuple(hpx::get<Is>(soa)[rhs]..., rhs);
+            }
+        };
+
+        template <typename Less>
+        void parallel_merge_sort(std::vector<std::size_t>& perm,
+            std::size_t num_threads, Less const& less)
+        {
+            // don't bother splitting small inputs
+            std::size_t const min_chunk = 4096;
+            std::size_t const count = perm.size();
+            num_threads = (std::min)(num_threads, count / min_chunk);
+            if (num_threads <= 1)
+            {
+                std::sort(perm.begin(), perm.end(), less);
+                return;
+            }
+
+            std::vector<std::size_t> bounds(num_threads + 1);
+            for (std::size_t k = 0; k <= num_threads; ++k)
+                bounds[k] = count * k / num_threads;
+
+            std::vector<std::thread> threads;
+            threads.reserve(num_threads);
+            for (std::size_t k = 0; k != num_threads; ++k)
+            {
+                threads.emplace_back([&, k] {
+                    std::sort(perm.begin() + bounds[k],
+                        perm.begin() + bounds[k + 1], less);
+                });
+            }
+            for (auto& t : threads)
+                t.join();
+
+            // merge neighbouring sorted runs, doubling their width each round
+            for (std::size_t width = 1; width < num_threads; width *= 2)
+            {
+                threads.clear();
+                for (std::size_t k = 0; k + width < num_threads; k += 2 * width)
+                {
+                    std::size_t const last =
+                        (std::min)(k + 2 * width, num_threads);
+                    threads.emplace_back([&, k, width, last] {
+                        std::inplace_merge(perm.begin() + bounds[k],
+                            perm.begin() + bounds[k + width],
+                            perm.begin() + bounds[last], less);
+                    });
+                }
+                for (auto& t : threads)
+                    t.join();
+            }
+        }
+
+        // Reorders column such that column[i] becomes the old
+        // column[perm[i]].
+        template <typename Column>
+        void gather_column(
+            Column& column, std::vector<std::size_t> const& perm)
+        {
+            using value_type =
+                typename std::decay<decltype(column[0])>::type;
+
+            std::vector<value_type> tmp;
+            tmp.reserve(perm.size());
+            for (std::size_t i : perm)
+                tmp.push_back(std::move(column[i]));
+
+            for (std::size_t i = 0; i != perm.size(); ++i)
+                column[i] = std::move(tmp[i]);
+        }
+
+        template <std::size_t... Cs, typename SoA>
+        void gather_columns(util::index_pack<Cs...>, SoA& soa,
+            std::vector<std::size_t> const& perm)
+        {
+            (gather_column(hpx::get<Cs>(soa), perm), ...);
+        }
+    }    // namespace detail
+
+    // Returns the permutation of the row indices of soa which sorts the rows
+    // by the key columns Is..., compared lexicographically in the given
+    // order. soa is a tuple of equally sized random access containers, for
+    // instance tie(ids, names, values). Rows with equal keys keep their
+    // relative order.
+    template <std::size_t... Is, typename SoA>
+    std::vector<std::size_t> sort_permutation_by_columns(
+        SoA& soa, std::size_t num_threads = 1)
+    {
+        static_assert(sizeof...(Is) != 0, "at least one key column is needed");
+
+        std::vector<std::size_t> perm(hpx::get<0>(soa).size());
+        std::iota(perm.begin(), perm.end(), std::size_t(0));
+
+        detail::parallel_merge_sort(
+            perm, num_threads, detail::columns_less<SoA, Is...>{soa});
+        return perm;
+    }
+
+    // Sorts the rows of soa by the key columns Is..., see
+    // sort_permutation_by_columns. All columns of soa are reordered.
+    template <std::size_t... Is, typename SoA>
+    void sort_by_columns(SoA&& soa, std::size_t num_threads = 1)
+    {
+        std::vector<std::size_t> const perm =
+            sort_permutation_by_columns<Is...>(soa, num_threads);
+        detail::gather_columns(
+            typename util::make_index_pack<
+                tuple_size<typename std::decay<SoA>::type>::value>::type{},
+            soa, perm);
+    }
+}    // namespace hpx
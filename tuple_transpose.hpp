@@ -0,0 +1,136 @@
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Conversion between a sequence of tuples (array of structures) and one
+// sequence per tuple element (structure of arrays). Rows are processed in
+// tiles small enough to stay in the L1 cache: each tile is traversed once per
+// column, so that every column is read or written sequentially while the
+// rows of the tile are only fetched from memory once. Tiles can optionally be
+// distributed over several threads.
+
+#pragma once
+
+#include "try_tuple.hpp"
+
+#include <algorithm>
+#include <cstddef>    // for size_t
+#include <iterator>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace hpx {
+
+    namespace detail {
+
+        // number of rows per tile, aiming at 8kB worth of rows
+        template <typename Row>
+        struct transpose_tile_size
+          : std::integral_constant<std::size_t,
+                (sizeof(Row) < 8192 ? 8192 / sizeof(Row) : 1)>
+        {
+        };
+
+        // Calls f(begin, end) for consecutive tiles of [0, count), splitting
+        // the tiles evenly between num_threads threads.
+        template <typename F>
+        void transpose_tiled(std::size_t count, std::size_t tile_size,
+            std::size_t num_threads, F const& f)
+        {
+            auto run = [&](std::size_t begin, std::size_t end) {
+                for (std::size_t b = begin; b < end; b += tile_size)
+                    f(b, (std::min)(b + tile_size, end));
+            };
+
+            std::size_t const num_tiles = (count + tile_size - 1) / tile_size;
+            num_threads = (std::min)(num_threads, num_tiles);
+            if (num_threads <= 1)
+            {
+                run(0, count);
+                return;
+            }
+
+            std::size_t const chunk =
+                (num_tiles + num_threads - 1) / num_threads * tile_size;
+
+            std::vector<std::thread> threads;
+            threads.reserve(num_threads - 1);
+            for (std::size_t begin = chunk; begin < count; begin += chunk)
+            {
+                threads.emplace_back(
+                    run, begin, (std::min)(begin + chunk, count));
+            }
+            run(0, (std::min)(chunk, count));
+
+            for (auto& t : threads)
+                t.join();
+        }
+
+        template <std::size_t... Is, typename RandomIt, typename Columns>
+        void transpose_to_soa_tile(util::index_pack<Is...>, RandomIt rows,
+            Columns const& columns, std::size_t begin, std::size_t end)
+        {
+            (
+                [&] {
+                    auto column = hpx::get<Is>(columns);
+                    for (std::size_t r = begin; r != end; ++r)
+                        column[r] = hpx::get<Is>(rows[r]);
+                }(),
+                ...);
+        }
+
+        template <std::size_t... Is, typename Columns, typename RandomIt>
+        void transpose_to_aos_tile(util::index_pack<Is...>,
+            Columns const& columns, RandomIt rows, std::size_t begin,
+            std::size_t end)
+        {
+            (
+                [&] {
+                    auto column = hpx::get<Is>(columns);
+                    for (std::size_t r = begin; r != end; ++r)
+                        hpx::get<Is>(rows[r]) = column[r];
+                }(),
+                ...);
+        }
+    }    // namespace detail
+
+    // Copies the elements of the tuples in [first, last) into the columns,
+    // element I of every row is written to get<I>(columns)[row]. The columns
+    // are random access iterators, for instance pointers into vectors.
+    template <typename RandomIt, typename... OutIts>
+    void transpose_to_soa(RandomIt first, RandomIt last,
+        tuple<OutIts...> const& columns, std::size_t num_threads = 1)
+    {
+        using row_type = typename std::iterator_traits<RandomIt>::value_type;
+        static_assert(tuple_size<row_type>::value == sizeof...(OutIts),
+            "the number of columns must match the size of the rows");
+
+        detail::transpose_tiled(static_cast<std::size_t>(last - first),
+            detail::transpose_tile_size<row_type>::value, num_threads,
+            [&](std::size_t begin, std::size_t end) {
+                detail::transpose_to_soa_tile(
+                    typename util::make_index_pack<sizeof...(OutIts)>::type{},
+                    first, columns, begin, end);
+            });
+    }
+
+    // Assembles count tuples from the columns and writes them to the rows
+    // starting at dest, the inverse of transpose_to_soa.
+    template <typename... InIts, typename RandomIt>
+    void transpose_to_aos(tuple<InIts...> const& columns, std::size_t count,
+        RandomIt dest, std::size_t num_threads = 1)
+    {
+        using row_type = typename std::iterator_traits<RandomIt>::value_type;
+        static_assert(tuple_size<row_type>::value == sizeof...(InIts),
+            "the number of columns must match the size of the rows");
+
+        detail::transpose_tiled(count,
+            detail::transpose_tile_size<row_type>::value, num_threads,
+            [&](std::size_t begin, std::size_t end) {
+                detail::transpose_to_aos_tile(
+                    typename util::make_index_pack<sizeof...(InIts)>::type{},
+                    columns, dest, begin, end);
+            });
+    }
+}    // namespace hpx
@@ -0,0 +1,236 @@
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// unique_function<R(Ts...), BufferSize> is a move-only, type-erased callable.
+// Callables of at most BufferSize bytes (for instance the result of
+// deferred_call(f, args...) for small f and args) are stored inline, only
+// larger ones are allocated on the heap. Moving a unique_function never
+// allocates: inline callables are move-constructed into the new buffer, heap
+// allocated ones just change owners.
+
+#pragma once
+
+#include <cstddef>    // for size_t
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace hpx {
+
+    template <typename Sig, std::size_t BufferSize = 3 * sizeof(void*)>
+    class unique_function;
+
+    namespace detail {
+
+        template <typename R, typename... Ts>
+        struct unique_function_vtable
+        {
+            R (*invoke)(void*, Ts&&...);
+            // move-constructs the callable from src into dest and destroys the
+            // one in src
+            void (*relocate)(void* dest, void* src) noexcept;
+            void (*destroy)(void*) noexcept;
+        };
+
+        template <typename F, std::size_t BufferSize>
+        struct unique_function_is_inline
+          : std::integral_constant<bool,
+                sizeof(F) <= BufferSize &&
+                    alignof(F) <= alignof(std::max_align_t) &&
+                    std::is_nothrow_move_constructible<F>::value>
+        {
+        };
+
+        // vtable for callables stored inside the buffer
+        template <typename F, typename R, typename... Ts>
+        struct unique_function_inline_vtable
+        {
+            static R invoke(void* p, Ts&&... vs)
+            {
+                return static_cast<R>(
+                    (*static_cast<F*>(p))(std::forward<Ts>(vs)...));
+            }
+
+            static void relocate(void* dest, void* src) noexcept
+            {
+                ::new (dest) F(std::move(*static_cast<F*>(src)));
+                static_cast<F*>(src)->~F();
+            }
+
+            static void destroy(void* p) noexcept
+            {
+                static_cast<F*>(p)->~F();
+            }
+
+            static constexpr unique_function_vtable<R, Ts...> value = {
+                &invoke, &relocate, &destroy};
+        };
+
+        template <typename F, typename R, typename... Ts>
+        constexpr unique_function_vtable<R, Ts...>
+            unique_function_inline_vtable<F, R, Ts...>::value;
+
+        // vtable for callables allocated on the heap, the buffer holds the
+        // pointer to the callable
+        template <typename F, typename R, typename... Ts>
+        struct unique_function_heap_vtable
+        {
+            static F*& target(void* p) noexcept
+            {
+                return *static_cast<F**>(p);
+            }
+
+            static R invoke(void* p, Ts&&... vs)
+            {
+                return static_cast<R>((*target(p))(std::forward<Ts>(vs)...));
+            }
+
+            static void relocate(void* dest, void* src) noexcept
+            {
+                ::new (dest) F*(target(src));
+            }
+
+            static void destroy(void* p) noexcept
+            {
+                delete target(p);
+            }
+
+            static constexpr unique_function_vtable<R, Ts...> value = {
+                &invoke, &relocate, &destroy};
+        };
+
+        template <typename F, typename R, typename... Ts>
+        constexpr unique_function_vtable<R, Ts...>
+            unique_function_heap_vtable<F, R, Ts...>::value;
+
+        template <typename T>
+        struct is_unique_function : std::false_type
+        {
+        };
+
+        template <typename Sig, std::size_t BufferSize>
+        struct is_unique_function<unique_function<Sig, BufferSize>>
+          : std::true_type
+        {
+        };
+    }    // namespace detail
+
+    template <typename R, typename... Ts, std::size_t BufferSize>
+    class unique_function<R(Ts...), BufferSize>
+    {
+        static_assert(BufferSize >= sizeof(void*),
+            "the buffer has to be able to hold at least a pointer");
+
+        using vtable = detail::unique_function_vtable<R, Ts...>;
+
+    public:
+        using result_type = R;
+
+        unique_function() noexcept
+          : _vptr(nullptr)
+        {
+        }
+
+        unique_function(std::nullptr_t) noexcept
+          : _vptr(nullptr)
+        {
+        }
+
+        template <typename F, typename FD = typename std::decay<F>::type,
+            typename Enable = typename std::enable_if<
+                !detail::is_unique_function<FD>::value>::type>
+        unique_function(F&& f)
+          : _vptr(nullptr)
+        {
+            assign(std::forward<F>(f));
+        }
+
+        unique_function(unique_function&& other) noexcept
+          : _vptr(other._vptr)
+        {
+            if (_vptr != nullptr)
+            {
+                _vptr->relocate(&_storage, &other._storage);
+                other._vptr = nullptr;
+            }
+        }
+
+        unique_function& operator=(unique_function&& other) noexcept
+        {
+            if (this != &other)
+            {
+                reset();
+                if (other._vptr != nullptr)
+                {
+                    other._vptr->relocate(&_storage, &other._storage);
+                    _vptr = other._vptr;
+                    other._vptr = nullptr;
+                }
+            }
+            return *this;
+        }
+
+        unique_function(unique_function const&) = delete;
+        unique_function& operator=(unique_function const&) = delete;
+
+        ~unique_function()
+        {
+            reset();
+        }
+
+        void reset() noexcept
+        {
+            if (_vptr != nullptr)
+            {
+                _vptr->destroy(&_storage);
+                _vptr = nullptr;
+            }
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return _vptr != nullptr;
+        }
+
+        // Whether a callable of type F would be stored without allocating.
+        template <typename F>
+        static constexpr bool is_inline() noexcept
+        {
+            return detail::unique_function_is_inline<F, BufferSize>::value;
+        }
+
+        R operator()(Ts... vs)
+        {
+            if (_vptr == nullptr)
+                throw std::bad_function_call();
+
+            return _vptr->invoke(&_storage, std::forward<Ts>(vs)...);
+        }
+
+    private:
+        template <typename F>
+        void assign(F&& f)
+        {
+            using target_type = typename std::decay<F>::type;
+            if constexpr (is_inline<target_type>())
+            {
+                ::new (&_storage) target_type(std::forward<F>(f));
+                _vptr = &detail::unique_function_inline_vtable<target_type, R,
+                    Ts...>::value;
+            }
+            else
+            {
+                ::new (&_storage) target_type*(
+                    new target_type(std::forward<F>(f)));
+                _vptr = &detail::unique_function_heap_vtable<target_type, R,
+                    Ts...>::value;
+            }
+        }
+
+        vtable const* _vptr;
+        typename std::aligned_storage<BufferSize,
+            alignof(std::max_align_t)>::type _storage;
+    };
+}    // namespace hpx
@@ -0,0 +1,434 @@
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// co_await when_all(awaitables...) awaits all of its arguments concurrently
+// and yields the tuple<Rs...> of their results, where Rs are the decayed
+// results of co_await'ing each argument. The results are assigned directly
+// to the elements of that tuple, they therefore have to be default
+// constructible and move assignable. The completions are counted down by a
+// single atomic counter, the last one resumes the awaiting coroutine. The
+// arguments are awaited by one small coroutine each, whose frame is placed
+// into a buffer inside the when_all object as long as it fits.
+//
+// single_thread_executor is a minimal scheduler running coroutines on the
+// calling thread, sync_wait drives an awaitable to completion on it.
+//
+// Only available if the compiler supports coroutines (C++20).
+
+#pragma once
+
+#include "always_void.hpp"
+#include "try_tuple.hpp"
+
+#if defined(__cpp_impl_coroutine)
+
+#include <atomic>
+#include <coroutine>
+#include <cstddef>    // for size_t
+#include <deque>
+#include <exception>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace hpx {
+
+    namespace detail {
+
+        template <typename Awaitable, typename Enable = void>
+        struct awaiter_of
+        {
+            using type = Awaitable;
+        };
+
+        template <typename Awaitable>
+        struct awaiter_of<Awaitable,
+            typename util::always_void<decltype(
+                std::declval<Awaitable>().operator co_await())>::type>
+        {
+            using type =
+                decltype(std::declval<Awaitable>().operator co_await());
+        };
+
+        // The type of co_await std::declval<Awaitable>(), for awaiters and
+        // types with a member operator co_await.
+        template <typename Awaitable>
+        using await_result_t = decltype(
+            std::declval<typename awaiter_of<Awaitable>::type&>()
+                .await_resume());
+
+        // Shared by the coroutines awaiting the arguments of a when_all.
+        struct when_all_counter
+        {
+            explicit when_all_counter(std::size_t count) noexcept
+              : remaining(count)
+            {
+            }
+
+            // Decrements the counter, returns the coroutine to resume next.
+            std::coroutine_handle<> notify() noexcept
+            {
+                if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                    return continuation;
+                return std::noop_coroutine();
+            }
+
+            std::atomic<std::size_t> remaining;
+            std::coroutine_handle<> continuation;
+            std::atomic<bool> failed{false};
+            std::exception_ptr exception;
+        };
+
+        // Storage for the frame of one of the coroutines awaiting an
+        // argument of when_all. Larger frames are allocated on the heap.
+        struct when_all_frame_buffer
+        {
+            static constexpr std::size_t capacity = 256;
+
+            alignas(__STDCPP_DEFAULT_NEW_ALIGNMENT__) unsigned char
+                data[capacity];
+        };
+
+        class when_all_child
+        {
+        public:
+            struct promise_type
+            {
+                template <typename... Args>
+                promise_type(when_all_frame_buffer&, when_all_counter& counter,
+                    Args&...) noexcept
+                  : counter(counter)
+                {
+                }
+
+                template <typename... Args>
+                static void* operator new(std::size_t size,
+                    when_all_frame_buffer& buffer, Args&...)
+                {
+                    if (size <= when_all_frame_buffer::capacity)
+                        return buffer.data;
+                    return ::operator new(size);
+                }
+
+                // the decision depends on the size only, which is the same
+                // as for the allocation
+                static void operator delete(void* p, std::size_t size) noexcept
+                {
+                    if (size > when_all_frame_buffer::capacity)
+                        ::operator delete(p);
+                }
+
+                when_all_child get_return_object() noexcept
+                {
+                    return when_all_child(
+                        std::coroutine_handle<promise_type>::from_promise(
+                            *this));
+                }
+
+                std::suspend_always initial_suspend() noexcept
+                {
+                    return {};
+                }
+
+                struct final_awaiter
+                {
+                    bool await_ready() const noexcept
+                    {
+                        return false;
+                    }
+
+                    std::coroutine_handle<> await_suspend(
+                        std::coroutine_handle<promise_type> h) noexcept
+                    {
+                        return h.promise().counter.notify();
+                    }
+
+                    void await_resume() const noexcept {}
+                };
+
+                final_awaiter final_suspend() noexcept
+                {
+                    return {};
+                }
+
+                void return_void() noexcept {}
+
+                // the first exception is rethrown by the awaiting coroutine
+                void unhandled_exception() noexcept
+                {
+                    if (!counter.failed.exchange(true))
+                        counter.exception = std::current_exception();
+                }
+
+                when_all_counter& counter;
+            };
+
+            when_all_child() noexcept = default;
+
+            when_all_child(when_all_child&& other) noexcept
+              : _handle(std::exchange(other._handle, nullptr))
+            {
+            }
+
+            when_all_child& operator=(when_all_child&& other) noexcept
+            {
+                std::swap(_handle, other._handle);
+                return *this;
+            }
+
+            ~when_all_child()
+            {
+                if (_handle)
+                    _handle.destroy();
+            }
+
+            void start() noexcept
+            {
+                _handle.resume();
+            }
+
+        private:
+            explicit when_all_child(
+                std::coroutine_handle<promise_type> handle) noexcept
+              : _handle(handle)
+            {
+            }
+
+            std::coroutine_handle<promise_type> _handle;
+        };
+
+        template <typename Awaitable, typename Result>
+        when_all_child when_all_await(when_all_frame_buffer&,
+            when_all_counter&, Awaitable& awaitable, Result& result)
+        {
+            result = co_await std::move(awaitable);
+        }
+
+        template <typename Awaitable>
+        struct when_all_result
+        {
+            using type = typename std::decay<
+                await_result_t<typename std::decay<Awaitable>::type&&>>::type;
+
+            static_assert(!std::is_void<type>::value,
+                "when_all does not support awaitables yielding void");
+            static_assert(std::is_default_constructible<type>::value &&
+                    std::is_move_assignable<type>::value,
+                "the results of the awaitables passed to when_all have to be "
+                "default constructible and move assignable");
+        };
+
+        template <typename Is, typename... Awaitables>
+        class when_all_awaitable;
+
+        template <std::size_t... Is, typename... Awaitables>
+        class when_all_awaitable<util::index_pack<Is...>, Awaitables...>
+        {
+        public:
+            using result_type =
+                tuple<typename when_all_result<Awaitables>::type...>;
+
+            template <typename... Ts>
+            explicit when_all_awaitable(std::true_type, Ts&&... ts)
+              : _awaitables(std::forward<Ts>(ts)...)
+              , _counter(sizeof...(Awaitables) + 1)
+              , _results()
+            {
+            }
+
+            // The coroutines awaiting the arguments refer to this object, it
+            // can only be moved before being co_await'ed.
+            when_all_awaitable(when_all_awaitable&& other)
+              : _awaitables(std::move(other._awaitables))
+              , _counter(sizeof...(Awaitables) + 1)
+              , _results()
+            {
+            }
+
+            when_all_awaitable& operator=(when_all_awaitable&&) = delete;
+
+            bool await_ready() const noexcept
+            {
+                return sizeof...(Awaitables) == 0;
+            }
+
+            // Starts awaiting all arguments, the awaiting coroutine is not
+            // suspended if all of them completed synchronously.
+            bool await_suspend(std::coroutine_handle<> continuation) noexcept
+            {
+                _counter.continuation = continuation;
+                ((_children[Is] = when_all_await(_frames[Is], _counter,
+                      hpx::get<Is>(_awaitables), hpx::get<Is>(_results))),
+                    ...);
+                (_children[Is].start(), ...);
+                return _counter.remaining.fetch_sub(
+                           1, std::memory_order_acq_rel) != 1;
+            }
+
+            result_type await_resume()
+            {
+                if (_counter.exception)
+                    std::rethrow_exception(_counter.exception);
+                return std::move(_results);
+            }
+
+        private:
+            tuple<Awaitables...> _awaitables;
+            when_all_counter _counter;
+            result_type _results;
+            when_all_frame_buffer _frames[sizeof...(Awaitables) + 1];
+            when_all_child _children[sizeof...(Awaitables) + 1];
+        };
+    }    // namespace detail
+
+    // The awaitables are moved (or copied) into the returned object.
+    template <typename... Awaitables>
+    detail::when_all_awaitable<
+        typename util::make_index_pack<sizeof...(Awaitables)>::type,
+        typename std::decay<Awaitables>::type...>
+    when_all(Awaitables&&... awaitables)
+    {
+        return detail::when_all_awaitable<
+            typename util::make_index_pack<sizeof...(Awaitables)>::type,
+            typename std::decay<Awaitables>::type...>(
+            std::true_type{}, std::forward<Awaitables>(awaitables)...);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Runs coroutines on the thread calling run(), in the order in which they
+    // were scheduled.
+    class single_thread_executor
+    {
+    public:
+        struct schedule_awaiter
+        {
+            bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            void await_suspend(std::coroutine_handle<> h)
+            {
+                executor._queue.push_back(h);
+            }
+
+            void await_resume() const noexcept {}
+
+            single_thread_executor& executor;
+        };
+
+        single_thread_executor() = default;
+
+        single_thread_executor(single_thread_executor const&) = delete;
+        single_thread_executor& operator=(
+            single_thread_executor const&) = delete;
+
+        // co_await schedule() continues the coroutine on this executor
+        schedule_awaiter schedule() noexcept
+        {
+            return schedule_awaiter{*this};
+        }
+
+        // Resumes the coroutine scheduled first. Returns false if there is
+        // none.
+        bool run_one()
+        {
+            if (_queue.empty())
+                return false;
+
+            std::coroutine_handle<> h = _queue.front();
+            _queue.pop_front();
+            h.resume();
+            return true;
+        }
+
+        void run()
+        {
+            while (run_one())
+            {
+            }
+        }
+
+    private:
+        std::deque<std::coroutine_handle<>> _queue;
+    };
+
+    namespace detail {
+
+        // A coroutine which starts immediately and destroys itself when
+        // done.
+        struct sync_wait_task
+        {
+            struct promise_type
+            {
+                sync_wait_task get_return_object() noexcept
+                {
+                    return {};
+                }
+
+                std::suspend_never initial_suspend() noexcept
+                {
+                    return {};
+                }
+
+                std::suspend_never final_suspend() noexcept
+                {
+                    return {};
+                }
+
+                void return_void() noexcept {}
+
+                void unhandled_exception() noexcept
+                {
+                    std::terminate();
+                }
+            };
+        };
+
+        template <typename Awaitable, typename Result>
+        sync_wait_task sync_wait_run(Awaitable& awaitable,
+            std::optional<Result>& result, std::exception_ptr& exception)
+        {
+            try
+            {
+                result.emplace(co_await std::forward<Awaitable>(awaitable));
+            }
+            catch (...)
+            {
+                exception = std::current_exception();
+            }
+        }
+    }    // namespace detail
+
+    // Awaits awaitable, running the coroutines scheduled on executor until it
+    // completes. Throws std::logic_error if the executor runs out of work
+    // before that.
+    template <typename Awaitable>
+    typename std::decay<detail::await_result_t<Awaitable&&>>::type sync_wait(
+        single_thread_executor& executor, Awaitable&& awaitable)
+    {
+        using result_type =
+            typename std::decay<detail::await_result_t<Awaitable&&>>::type;
+
+        std::optional<result_type> result;
+        std::exception_ptr exception;
+        detail::sync_wait_run<Awaitable&&>(awaitable, result, exception);
+
+        while (!result && !exception)
+        {
+            if (!executor.run_one())
+            {
+                throw std::logic_error(
+                    "sync_wait: the awaitable did not complete");
+            }
+        }
+        if (exception)
+            std::rethrow_exception(exception);
+        return std::move(*result);
+    }
+}    // namespace hpx
+
+#endif